@@ -195,12 +195,12 @@ ifneq ($(strip $(EEPROM_DRIVER)),none)
       # External I2C EEPROM implementation
       OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_I2C
       I2C_DRIVER_REQUIRED = yes
-      SRC += eeprom_driver.c eeprom_i2c.c
+      SRC += eeprom_driver.c eeprom_i2c.c eeprom_page_cache.c
     else ifeq ($(strip $(EEPROM_DRIVER)), spi)
       # External SPI EEPROM implementation
       OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_SPI
       SPI_DRIVER_REQUIRED = yes
-      SRC += eeprom_driver.c eeprom_spi.c
+      SRC += eeprom_driver.c eeprom_spi.c eeprom_page_cache.c
     else ifeq ($(strip $(EEPROM_DRIVER)), legacy_stm32_flash)
       # STM32 Emulated EEPROM, backed by MCU flash (soon to be deprecated)
       OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_LEGACY_EMULATED_FLASH
@@ -689,7 +689,8 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     CRC_ENABLE := yes
 
     # Include files used by all split keyboards
-    QUANTUM_SRC += $(QUANTUM_DIR)/split_common/split_util.c
+    QUANTUM_SRC += $(QUANTUM_DIR)/split_common/split_util.c \
+                   $(QUANTUM_DIR)/split_common/split_link_stats.c
 
     # Determine which (if any) transport files are required
     ifneq ($(strip $(SPLIT_TRANSPORT)), custom)
@@ -22,3 +22,7 @@
 void eeprom_driver_init(void);
 void eeprom_driver_format(bool erase);
 void eeprom_driver_erase(void);
+
+// Optional, for drivers which defer writes -- weak no-op implementations are provided
+void eeprom_driver_task(void);
+void eeprom_driver_flush(void);
@@ -39,6 +39,10 @@
 #include "eeprom_driver.h"
 #include "eeprom_i2c.h"
 
+#ifdef EXTERNAL_EEPROM_PAGE_CACHE
+#    include "eeprom_page_cache.h"
+#endif
+
 // #define DEBUG_EEPROM_OUTPUT
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
@@ -54,8 +58,13 @@ static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     }
 }
 
+static void i2c_eeprom_write(const void *buf, void *addr, size_t len);
+
 void eeprom_driver_init(void) {
     i2c_init();
+#ifdef EXTERNAL_EEPROM_PAGE_CACHE
+    eeprom_page_cache_init();
+#endif
 #if defined(EXTERNAL_EEPROM_WP_PIN)
     /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
     gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
@@ -77,8 +86,12 @@ void eeprom_driver_erase(void) {
 
     uint8_t buf[EXTERNAL_EEPROM_PAGE_SIZE];
     memset(buf, 0x00, EXTERNAL_EEPROM_PAGE_SIZE);
+#ifdef EXTERNAL_EEPROM_PAGE_CACHE
+    // Everything cached is about to be overwritten, including any unwritten changes
+    eeprom_page_cache_invalidate();
+#endif
     for (uint32_t addr = 0; addr < EXTERNAL_EEPROM_BYTE_COUNT; addr += EXTERNAL_EEPROM_PAGE_SIZE) {
-        eeprom_write_block(buf, (void *)(uintptr_t)addr, EXTERNAL_EEPROM_PAGE_SIZE);
+        i2c_eeprom_write(buf, (void *)(uintptr_t)addr, EXTERNAL_EEPROM_PAGE_SIZE);
     }
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
@@ -86,7 +99,7 @@ void eeprom_driver_erase(void) {
 #endif
 }
 
-void eeprom_read_block(void *buf, const void *addr, size_t len) {
+static void i2c_eeprom_read(void *buf, const void *addr, size_t len) {
     uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
     fill_target_address(complete_packet, addr);
 
@@ -102,7 +115,7 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 #endif // DEBUG_EEPROM_OUTPUT
 }
 
-void eeprom_write_block(const void *buf, void *addr, size_t len) {
+static void i2c_eeprom_write(const void *buf, void *addr, size_t len) {
     uint8_t   complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
     uint8_t  *read_buf    = (uint8_t *)buf;
     uintptr_t target_addr = (uintptr_t)addr;
@@ -146,3 +159,29 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     gpio_set_pin_input_high(EXTERNAL_EEPROM_WP_PIN);
 #endif
 }
+
+#ifdef EXTERNAL_EEPROM_PAGE_CACHE
+void eeprom_page_cache_backend_read(uint32_t addr, void *buf, size_t len) {
+    i2c_eeprom_read(buf, (const void *)(uintptr_t)addr, len);
+}
+
+void eeprom_page_cache_backend_write(uint32_t addr, const void *buf, size_t len) {
+    i2c_eeprom_write(buf, (void *)(uintptr_t)addr, len);
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_page_cache_read((uintptr_t)addr, buf, len);
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    eeprom_page_cache_write((uintptr_t)addr, buf, len);
+}
+#else
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    i2c_eeprom_read(buf, addr, len);
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    i2c_eeprom_write(buf, addr, len);
+}
+#endif // EXTERNAL_EEPROM_PAGE_CACHE
@@ -0,0 +1,188 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <string.h>
+
+#include "eeprom_page_cache.h"
+
+#ifdef EXTERNAL_EEPROM_PAGE_CACHE
+#    include "timer.h"
+#    include "eeprom_driver.h"
+
+typedef struct eeprom_page_cache_line_t {
+    uint32_t page;
+    uint16_t dirty_start; // first dirty byte within the page
+    uint16_t dirty_end;   // one past the last dirty byte, equal to dirty_start when clean
+    uint32_t last_used;
+    bool     valid;
+    uint8_t  data[EXTERNAL_EEPROM_PAGE_SIZE];
+} eeprom_page_cache_line_t;
+
+static eeprom_page_cache_line_t  lines[EXTERNAL_EEPROM_PAGE_CACHE_LINES];
+static eeprom_page_cache_stats_t stats;
+static uint32_t                  use_counter = 0;
+static uint32_t                  last_write  = 0;
+
+static bool line_is_dirty(const eeprom_page_cache_line_t *line) {
+    return line->valid && line->dirty_end > line->dirty_start;
+}
+
+static void line_flush(eeprom_page_cache_line_t *line) {
+    if (!line_is_dirty(line)) {
+        return;
+    }
+
+    // Only the span between the first and last changed byte goes over the bus, as a single page program
+    size_t len = line->dirty_end - line->dirty_start;
+    eeprom_page_cache_backend_write(line->page + line->dirty_start, &line->data[line->dirty_start], len);
+    stats.page_writes++;
+    stats.bytes_written += len;
+    line->dirty_start = line->dirty_end = 0;
+}
+
+static eeprom_page_cache_line_t *line_find(uint32_t page) {
+    for (int i = 0; i < EXTERNAL_EEPROM_PAGE_CACHE_LINES; ++i) {
+        if (lines[i].valid && lines[i].page == page) {
+            stats.hits++;
+            lines[i].last_used = ++use_counter;
+            return &lines[i];
+        }
+    }
+    return NULL;
+}
+
+// Replaces the least recently used line, writing it back first if it was dirty
+static eeprom_page_cache_line_t *line_allocate(uint32_t page, bool fill) {
+    eeprom_page_cache_line_t *victim = &lines[0];
+    for (int i = 0; i < EXTERNAL_EEPROM_PAGE_CACHE_LINES; ++i) {
+        if (!lines[i].valid) {
+            victim = &lines[i];
+            break;
+        }
+        if (lines[i].last_used < victim->last_used) {
+            victim = &lines[i];
+        }
+    }
+
+    stats.misses++;
+    line_flush(victim);
+    victim->page        = page;
+    victim->valid       = true;
+    victim->dirty_start = victim->dirty_end = 0;
+    victim->last_used   = ++use_counter;
+    if (fill) {
+        eeprom_page_cache_backend_read(page, victim->data, EXTERNAL_EEPROM_PAGE_SIZE);
+    }
+    return victim;
+}
+
+void eeprom_page_cache_init(void) {
+    memset(lines, 0, sizeof(lines));
+    memset(&stats, 0, sizeof(stats));
+    use_counter = 0;
+}
+
+void eeprom_page_cache_read(uint32_t addr, void *buf, size_t len) {
+    uint8_t *p = (uint8_t *)buf;
+    while (len > 0) {
+        uint32_t offset = addr % EXTERNAL_EEPROM_PAGE_SIZE;
+        size_t   chunk  = EXTERNAL_EEPROM_PAGE_SIZE - offset;
+        if (chunk > len) {
+            chunk = len;
+        }
+
+        eeprom_page_cache_line_t *line = line_find(addr - offset);
+        if (!line) {
+            line = line_allocate(addr - offset, true);
+        }
+        memcpy(p, &line->data[offset], chunk);
+
+        p += chunk;
+        addr += chunk;
+        len -= chunk;
+    }
+}
+
+void eeprom_page_cache_write(uint32_t addr, const void *buf, size_t len) {
+    const uint8_t *p = (const uint8_t *)buf;
+    while (len > 0) {
+        uint32_t offset = addr % EXTERNAL_EEPROM_PAGE_SIZE;
+        size_t   chunk  = EXTERNAL_EEPROM_PAGE_SIZE - offset;
+        if (chunk > len) {
+            chunk = len;
+        }
+
+        eeprom_page_cache_line_t *line = line_find(addr - offset);
+        if (!line && chunk == EXTERNAL_EEPROM_PAGE_SIZE) {
+            // A write covering the whole page doesn't need the old contents
+            line = line_allocate(addr - offset, false);
+            memcpy(line->data, p, chunk);
+            line->dirty_start = 0;
+            line->dirty_end   = EXTERNAL_EEPROM_PAGE_SIZE;
+        } else {
+            if (!line) {
+                line = line_allocate(addr - offset, true);
+            }
+            for (size_t i = 0; i < chunk; ++i) {
+                uint16_t pos = offset + i;
+                if (line->data[pos] == p[i]) {
+                    continue;
+                }
+                line->data[pos] = p[i];
+                if (line->dirty_end == line->dirty_start) {
+                    line->dirty_start = pos;
+                    line->dirty_end   = pos + 1;
+                } else if (pos < line->dirty_start) {
+                    line->dirty_start = pos;
+                } else if (pos >= line->dirty_end) {
+                    line->dirty_end = pos + 1;
+                }
+            }
+        }
+
+        p += chunk;
+        addr += chunk;
+        len -= chunk;
+    }
+    last_write = timer_read32();
+}
+
+void eeprom_page_cache_task(void) {
+    // Bursts of updates to the same settings share a single page program once they settle
+    if (eeprom_page_cache_is_dirty() && timer_elapsed32(last_write) >= (EXTERNAL_EEPROM_PAGE_CACHE_IDLE_MS)) {
+        eeprom_page_cache_flush();
+    }
+}
+
+void eeprom_page_cache_flush(void) {
+    for (int i = 0; i < EXTERNAL_EEPROM_PAGE_CACHE_LINES; ++i) {
+        line_flush(&lines[i]);
+    }
+}
+
+void eeprom_page_cache_invalidate(void) {
+    for (int i = 0; i < EXTERNAL_EEPROM_PAGE_CACHE_LINES; ++i) {
+        lines[i].valid = false;
+    }
+}
+
+bool eeprom_page_cache_is_dirty(void) {
+    for (int i = 0; i < EXTERNAL_EEPROM_PAGE_CACHE_LINES; ++i) {
+        if (line_is_dirty(&lines[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const eeprom_page_cache_stats_t *eeprom_page_cache_get_stats(void) {
+    return &stats;
+}
+
+void eeprom_driver_task(void) {
+    eeprom_page_cache_task();
+}
+
+void eeprom_driver_flush(void) {
+    eeprom_page_cache_flush();
+}
+#endif // EXTERNAL_EEPROM_PAGE_CACHE
@@ -0,0 +1,58 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(EEPROM_I2C)
+#    include "eeprom_i2c.h"
+#elif defined(EEPROM_SPI)
+#    include "eeprom_spi.h"
+#endif
+
+/*
+    Write-back page cache for external EEPROMs.
+
+    Enabled with `EXTERNAL_EEPROM_PAGE_CACHE`. Each line holds one full device
+    page; reads are served from the cache, and writes only mark the bytes that
+    actually changed as dirty. Dirty lines are programmed as a single page
+    write once writes have been idle for `EXTERNAL_EEPROM_PAGE_CACHE_IDLE_MS`,
+    when the line is evicted, or when `eeprom_driver_flush()` is invoked.
+*/
+
+/*
+    The number of pages held in RAM.
+*/
+#ifndef EXTERNAL_EEPROM_PAGE_CACHE_LINES
+#    define EXTERNAL_EEPROM_PAGE_CACHE_LINES 4
+#endif
+
+/*
+    How long writes must have settled for before dirty pages are written back.
+*/
+#ifndef EXTERNAL_EEPROM_PAGE_CACHE_IDLE_MS
+#    define EXTERNAL_EEPROM_PAGE_CACHE_IDLE_MS 1000
+#endif
+
+typedef struct eeprom_page_cache_stats_t {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t page_writes;
+    uint32_t bytes_written;
+} eeprom_page_cache_stats_t;
+
+void eeprom_page_cache_init(void);
+void eeprom_page_cache_read(uint32_t addr, void *buf, size_t len);
+void eeprom_page_cache_write(uint32_t addr, const void *buf, size_t len);
+void eeprom_page_cache_task(void);
+void eeprom_page_cache_flush(void);
+void eeprom_page_cache_invalidate(void);
+bool eeprom_page_cache_is_dirty(void);
+
+const eeprom_page_cache_stats_t *eeprom_page_cache_get_stats(void);
+
+// Implemented by the underlying driver; writes never cross a page boundary
+void eeprom_page_cache_backend_read(uint32_t addr, void *buf, size_t len);
+void eeprom_page_cache_backend_write(uint32_t addr, const void *buf, size_t len);
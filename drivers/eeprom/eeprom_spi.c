@@ -38,6 +38,10 @@
 #include "eeprom_driver.h"
 #include "eeprom_spi.h"
 
+#ifdef EXTERNAL_EEPROM_PAGE_CACHE
+#    include "eeprom_page_cache.h"
+#endif
+
 #define CMD_WREN 6
 #define CMD_WRDI 4
 #define CMD_RDSR 5
@@ -89,8 +93,13 @@ static void spi_eeprom_transmit_address(uintptr_t addr) {
 
 //----------------------------------------------------------------------------------------------------------------------
 
+static void spi_eeprom_write(const void *buf, void *addr, size_t len);
+
 void eeprom_driver_init(void) {
     spi_init();
+#ifdef EXTERNAL_EEPROM_PAGE_CACHE
+    eeprom_page_cache_init();
+#endif
 }
 
 void eeprom_driver_format(bool erase) {
@@ -107,8 +116,12 @@ void eeprom_driver_erase(void) {
 
     uint8_t buf[EXTERNAL_EEPROM_PAGE_SIZE];
     memset(buf, 0x00, EXTERNAL_EEPROM_PAGE_SIZE);
+#ifdef EXTERNAL_EEPROM_PAGE_CACHE
+    // Everything cached is about to be overwritten, including any unwritten changes
+    eeprom_page_cache_invalidate();
+#endif
     for (uint32_t addr = 0; addr < EXTERNAL_EEPROM_BYTE_COUNT; addr += EXTERNAL_EEPROM_PAGE_SIZE) {
-        eeprom_write_block(buf, (void *)(uintptr_t)addr, EXTERNAL_EEPROM_PAGE_SIZE);
+        spi_eeprom_write(buf, (void *)(uintptr_t)addr, EXTERNAL_EEPROM_PAGE_SIZE);
     }
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
@@ -116,7 +129,7 @@ void eeprom_driver_erase(void) {
 #endif
 }
 
-void eeprom_read_block(void *buf, const void *addr, size_t len) {
+static void spi_eeprom_read(void *buf, const void *addr, size_t len) {
     //-------------------------------------------------
     // Wait for the write-in-progress bit to be cleared
     spi_status_t response = spi_eeprom_wait_while_busy(EXTERNAL_EEPROM_SPI_TIMEOUT);
@@ -152,7 +165,7 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     spi_stop();
 }
 
-void eeprom_write_block(const void *buf, void *addr, size_t len) {
+static void spi_eeprom_write(const void *buf, void *addr, size_t len) {
     bool      res;
     uint8_t  *read_buf    = (uint8_t *)buf;
     uintptr_t target_addr = (uintptr_t)addr;
@@ -223,3 +236,29 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     spi_write(CMD_WRDI);
     spi_stop();
 }
+
+#ifdef EXTERNAL_EEPROM_PAGE_CACHE
+void eeprom_page_cache_backend_read(uint32_t addr, void *buf, size_t len) {
+    spi_eeprom_read(buf, (const void *)(uintptr_t)addr, len);
+}
+
+void eeprom_page_cache_backend_write(uint32_t addr, const void *buf, size_t len) {
+    spi_eeprom_write(buf, (void *)(uintptr_t)addr, len);
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_page_cache_read((uintptr_t)addr, buf, len);
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    eeprom_page_cache_write((uintptr_t)addr, buf, len);
+}
+#else
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    spi_eeprom_read(buf, addr, len);
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    spi_eeprom_write(buf, addr, len);
+}
+#endif // EXTERNAL_EEPROM_PAGE_CACHE
@@ -6,6 +6,26 @@
 #include "eeprom_driver.h"
 #include "wear_leveling.h"
 
+#if defined(WEAR_LEVELING_COALESCE_WRITES) || defined(WEAR_LEVELING_INCREMENTAL_CONSOLIDATION)
+#    include "timer.h"
+#endif
+
+#ifdef WEAR_LEVELING_COALESCE_WRITES
+#    ifndef WEAR_LEVELING_COALESCE_IDLE_MS
+#        define WEAR_LEVELING_COALESCE_IDLE_MS 2000
+#    endif
+
+static uint32_t last_write = 0;
+#endif // WEAR_LEVELING_COALESCE_WRITES
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+#    ifndef WEAR_LEVELING_INCREMENTAL_INTERVAL_MS
+#        define WEAR_LEVELING_INCREMENTAL_INTERVAL_MS 100
+#    endif
+
+static uint32_t last_step = 0;
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 void eeprom_driver_init(void) {
     wear_leveling_init();
 }
@@ -26,4 +46,33 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 
 void eeprom_write_block(const void *buf, void *addr, size_t len) {
     wear_leveling_write((uint32_t)addr, buf, len);
+#ifdef WEAR_LEVELING_COALESCE_WRITES
+    last_write = timer_read32();
+#endif // WEAR_LEVELING_COALESCE_WRITES
+}
+
+#if defined(WEAR_LEVELING_COALESCE_WRITES) || defined(WEAR_LEVELING_INCREMENTAL_CONSOLIDATION)
+void eeprom_driver_task(void) {
+#    ifdef WEAR_LEVELING_COALESCE_WRITES
+    // Only flush once writes have settled, so bursts of updates share a single log append
+    if (wear_leveling_has_pending_writes() && timer_elapsed32(last_write) >= (WEAR_LEVELING_COALESCE_IDLE_MS)) {
+        wear_leveling_flush();
+        // Also throttles retries if the flush failed
+        last_write = timer_read32();
+    }
+#    endif // WEAR_LEVELING_COALESCE_WRITES
+#    ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    // A single chunk copy or erase unit at a time, spread out so the matrix scan is never stalled for long
+    if (wear_leveling_consolidation_pending() && timer_elapsed32(last_step) >= (WEAR_LEVELING_INCREMENTAL_INTERVAL_MS)) {
+        wear_leveling_consolidate_step();
+        last_step = timer_read32();
+    }
+#    endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+}
+#endif
+
+#ifdef WEAR_LEVELING_COALESCE_WRITES
+void eeprom_driver_flush(void) {
+    wear_leveling_flush();
 }
+#endif // WEAR_LEVELING_COALESCE_WRITES
@@ -121,6 +121,79 @@ flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len);
  */
 flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len);
 
+/**
+ * @brief Callback invoked when an asynchronous flash operation completes.
+ *
+ * @param status FLASH_STATUS_SUCCESS if the operation completed successfully, FLASH_STATUS_TIMEOUT if the flash stayed busy for too long, or FLASH_STATUS_ERROR if an error occurred.
+ * @param cb_arg The argument supplied when the operation was queued.
+ */
+typedef void (*flash_callback_t)(flash_status_t status, void *cb_arg);
+
+/**
+ * @brief Advances any queued asynchronous operations.
+ *
+ * This function issues at most one page program or erase per call and never waits for the flash to become ready.
+ * It is invoked from the main loop, and completion callbacks are invoked from within it.
+ *
+ * @return FLASH_STATUS_SUCCESS if there is nothing left to do, or FLASH_STATUS_BUSY if operations are still pending.
+ */
+flash_status_t flash_task(void);
+
+/**
+ * @brief Checks if all asynchronous operations have completed.
+ *
+ * @return true if no asynchronous operations are queued.
+ */
+bool flash_is_idle(void);
+
+/**
+ * @brief Queues a write of a range of flash memory.
+ *
+ * The buffer is programmed a page at a time by flash_task(), and must remain valid until the callback is invoked.
+ * Any synchronous flash function completes all queued operations before doing its own work.
+ *
+ * @param addr The address of the range to write.
+ * @param buf A pointer to the buffer to write to the range.
+ * @param len The length of the range to write.
+ * @param callback The function to invoke on completion, or NULL.
+ * @param cb_arg The argument passed to the callback.
+ *
+ * @return FLASH_STATUS_SUCCESS if the write was queued, FLASH_STATUS_BAD_ADDRESS if the address is out of bounds, or FLASH_STATUS_BUSY if the queue is full.
+ */
+flash_status_t flash_write_range_async(uint32_t addr, const void *buf, size_t len, flash_callback_t callback, void *cb_arg);
+
+/**
+ * @brief Queues an erase of a sector of flash memory.
+ *
+ * @param addr The address of the sector to erase.
+ * @param callback The function to invoke on completion, or NULL.
+ * @param cb_arg The argument passed to the callback.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase was queued, FLASH_STATUS_BAD_ADDRESS if the address is out of bounds, or FLASH_STATUS_BUSY if the queue is full.
+ */
+flash_status_t flash_erase_sector_async(uint32_t addr, flash_callback_t callback, void *cb_arg);
+
+/**
+ * @brief Queues an erase of a block of flash memory.
+ *
+ * @param addr The address of the block to erase.
+ * @param callback The function to invoke on completion, or NULL.
+ * @param cb_arg The argument passed to the callback.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase was queued, FLASH_STATUS_BAD_ADDRESS if the address is out of bounds, or FLASH_STATUS_BUSY if the queue is full.
+ */
+flash_status_t flash_erase_block_async(uint32_t addr, flash_callback_t callback, void *cb_arg);
+
+/**
+ * @brief Queues an erase of the entire flash memory chip.
+ *
+ * @param callback The function to invoke on completion, or NULL.
+ * @param cb_arg The argument passed to the callback.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase was queued, or FLASH_STATUS_BUSY if the queue is full.
+ */
+flash_status_t flash_erase_chip_async(flash_callback_t callback, void *cb_arg);
+
 #ifdef __cplusplus
 }
 #endif
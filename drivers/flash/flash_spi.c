@@ -2,6 +2,7 @@
 // Copyright 2024 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <inttypes.h>
 #include <string.h>
 
 #include "flash.h"
@@ -158,6 +159,195 @@ static flash_status_t spi_flash_transaction(uint8_t cmd, uint32_t addr, uint8_t
     return response;
 }
 
+/*
+    Asynchronous operations.
+
+    Queued writes and erases are advanced from `flash_task()`. Each call issues at most one page program or
+    erase and returns straight away, polling the status register on the next call instead of busy-waiting,
+    so the main loop keeps running while the chip is programming or erasing.
+*/
+typedef enum {
+    FLASH_ASYNC_WRITE,
+    FLASH_ASYNC_ERASE_SECTOR,
+    FLASH_ASYNC_ERASE_BLOCK,
+    FLASH_ASYNC_ERASE_CHIP,
+} flash_async_type_t;
+
+typedef struct flash_async_op_t {
+    flash_async_type_t type;
+    bool               issued;
+    uint32_t           addr;
+    const uint8_t     *buf;
+    size_t             len;
+    flash_callback_t   callback;
+    void              *cb_arg;
+} flash_async_op_t;
+
+static flash_async_op_t async_queue[EXTERNAL_FLASH_ASYNC_QUEUE_SIZE];
+static uint8_t          async_head    = 0;
+static uint8_t          async_count   = 0;
+static uint32_t         async_started = 0;
+
+static uint32_t spi_flash_async_timeout(const flash_async_op_t *op) {
+    // Chip erase can take a long time, allow 250x the usual timeout, same as `flash_wait_erase_chip()`
+    return (op->type == FLASH_ASYNC_ERASE_CHIP) ? (EXTERNAL_FLASH_SPI_TIMEOUT)*250 : (EXTERNAL_FLASH_SPI_TIMEOUT);
+}
+
+static flash_status_t spi_flash_async_enqueue(const flash_async_op_t *op) {
+    if (async_count >= EXTERNAL_FLASH_ASYNC_QUEUE_SIZE) {
+        return FLASH_STATUS_BUSY;
+    }
+
+    if (async_count == 0) {
+        async_started = timer_read32();
+    }
+    async_queue[(async_head + async_count) % EXTERNAL_FLASH_ASYNC_QUEUE_SIZE] = *op;
+    async_count++;
+    return FLASH_STATUS_SUCCESS;
+}
+
+static void spi_flash_async_complete(flash_status_t status) {
+    flash_async_op_t op = async_queue[async_head];
+    async_head          = (async_head + 1) % EXTERNAL_FLASH_ASYNC_QUEUE_SIZE;
+    async_count--;
+    async_started = timer_read32();
+
+    if (op.type == FLASH_ASYNC_WRITE && op.issued) {
+        spi_flash_write_disable();
+    }
+
+    // Dequeued first, so the callback is free to queue follow-up operations
+    if (op.callback) {
+        op.callback(status, op.cb_arg);
+    }
+}
+
+static flash_status_t spi_flash_async_issue(flash_async_op_t *op) {
+    flash_status_t response = spi_flash_write_enable();
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to write-enable! [spi flash async]\n");
+        return response;
+    }
+
+    switch (op->type) {
+        case FLASH_ASYNC_WRITE: {
+            uint32_t page_offset  = op->addr % EXTERNAL_FLASH_PAGE_SIZE;
+            size_t   write_length = EXTERNAL_FLASH_PAGE_SIZE - page_offset;
+            if (write_length > op->len) {
+                write_length = op->len;
+            }
+
+            response = spi_flash_transaction(FLASH_CMD_PP, op->addr, (uint8_t *)op->buf, write_length);
+            op->buf += write_length;
+            op->addr += write_length;
+            op->len -= write_length;
+            break;
+        }
+        case FLASH_ASYNC_ERASE_SECTOR:
+            response = spi_flash_transaction(FLASH_CMD_SE, op->addr, NULL, 0);
+            break;
+        case FLASH_ASYNC_ERASE_BLOCK:
+            response = spi_flash_transaction(FLASH_CMD_BE, op->addr, NULL, 0);
+            break;
+        case FLASH_ASYNC_ERASE_CHIP:
+            if (!spi_flash_start()) {
+                response = FLASH_STATUS_ERROR;
+                break;
+            }
+            spi_write(FLASH_CMD_CE);
+            spi_stop();
+            break;
+    }
+
+    if (response != FLASH_STATUS_SUCCESS) {
+        dprint("Failed to issue operation! [spi flash async]\n");
+        return response;
+    }
+
+    op->issued    = true;
+    async_started = timer_read32();
+    return FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t flash_task(void) {
+    while (async_count > 0) {
+        flash_async_op_t *op = &async_queue[async_head];
+
+        // Nothing may be sent to the chip other than a status read until the previous program or erase is done
+        flash_status_t response = flash_is_busy();
+        if (response == FLASH_STATUS_BUSY) {
+            if (timer_elapsed32(async_started) < spi_flash_async_timeout(op)) {
+                return FLASH_STATUS_BUSY;
+            }
+            dprint("Timed out waiting for WIP flag! [spi flash async]\n");
+            response = FLASH_STATUS_TIMEOUT;
+        }
+        if (response != FLASH_STATUS_SUCCESS) {
+            spi_flash_async_complete(response);
+            continue;
+        }
+
+        if (op->type == FLASH_ASYNC_WRITE ? (op->len == 0) : op->issued) {
+            spi_flash_async_complete(FLASH_STATUS_SUCCESS);
+            continue;
+        }
+
+        response = spi_flash_async_issue(op);
+        if (response != FLASH_STATUS_SUCCESS) {
+            spi_flash_async_complete(response);
+            continue;
+        }
+        return FLASH_STATUS_BUSY;
+    }
+
+    return FLASH_STATUS_SUCCESS;
+}
+
+// Synchronous operations run everything already queued first, so they observe queued writes in order
+static void spi_flash_async_drain(void) {
+    while (flash_task() == FLASH_STATUS_BUSY) {
+    }
+}
+
+bool flash_is_idle(void) {
+    return async_count == 0;
+}
+
+flash_status_t flash_write_range_async(uint32_t addr, const void *buf, size_t len, flash_callback_t callback, void *cb_arg) {
+    if ((addr + len) > (EXTERNAL_FLASH_SIZE)) {
+        dprintf("Flash write address over limit! [addr:0x%08" PRIx32 "]\n", (uint32_t)addr);
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+
+    flash_async_op_t op = {.type = FLASH_ASYNC_WRITE, .addr = addr, .buf = (const uint8_t *)buf, .len = len, .callback = callback, .cb_arg = cb_arg};
+    return spi_flash_async_enqueue(&op);
+}
+
+flash_status_t flash_erase_sector_async(uint32_t addr, flash_callback_t callback, void *cb_arg) {
+    if ((addr + (EXTERNAL_FLASH_SECTOR_SIZE)) > (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_SECTOR_SIZE)) != 0)) {
+        dprintf("Flash erase sector address over limit! [addr:0x%08" PRIx32 "]\n", (uint32_t)addr);
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+
+    flash_async_op_t op = {.type = FLASH_ASYNC_ERASE_SECTOR, .addr = addr, .callback = callback, .cb_arg = cb_arg};
+    return spi_flash_async_enqueue(&op);
+}
+
+flash_status_t flash_erase_block_async(uint32_t addr, flash_callback_t callback, void *cb_arg) {
+    if ((addr + (EXTERNAL_FLASH_BLOCK_SIZE)) > (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_BLOCK_SIZE)) != 0)) {
+        dprintf("Flash erase block address over limit! [addr:0x%08" PRIx32 "]\n", (uint32_t)addr);
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+
+    flash_async_op_t op = {.type = FLASH_ASYNC_ERASE_BLOCK, .addr = addr, .callback = callback, .cb_arg = cb_arg};
+    return spi_flash_async_enqueue(&op);
+}
+
+flash_status_t flash_erase_chip_async(flash_callback_t callback, void *cb_arg) {
+    flash_async_op_t op = {.type = FLASH_ASYNC_ERASE_CHIP, .callback = callback, .cb_arg = cb_arg};
+    return spi_flash_async_enqueue(&op);
+}
+
 void flash_init(void) {
     spi_init();
 }
@@ -165,6 +355,8 @@ void flash_init(void) {
 flash_status_t flash_begin_erase_chip(void) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
+    spi_flash_async_drain();
+
     /* Wait for the write-in-progress bit to be cleared. */
     response = spi_flash_wait_while_busy();
     if (response != FLASH_STATUS_SUCCESS) {
@@ -212,9 +404,11 @@ flash_status_t flash_erase_chip(void) {
 flash_status_t flash_erase_sector(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
+    spi_flash_async_drain();
+
     /* Check that the address exceeds the limit. */
-    if ((addr + (EXTERNAL_FLASH_SECTOR_SIZE)) >= (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_SECTOR_SIZE)) != 0)) {
-        dprintf("Flash erase sector address over limit! [addr:0x%lx]\n", (uint32_t)addr);
+    if ((addr + (EXTERNAL_FLASH_SECTOR_SIZE)) > (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_SECTOR_SIZE)) != 0)) {
+        dprintf("Flash erase sector address over limit! [addr:0x%08" PRIx32 "]\n", (uint32_t)addr);
         return FLASH_STATUS_ERROR;
     }
 
@@ -252,9 +446,11 @@ flash_status_t flash_erase_sector(uint32_t addr) {
 flash_status_t flash_erase_block(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
+    spi_flash_async_drain();
+
     /* Check that the address exceeds the limit. */
-    if ((addr + (EXTERNAL_FLASH_BLOCK_SIZE)) >= (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_BLOCK_SIZE)) != 0)) {
-        dprintf("Flash erase block address over limit! [addr:0x%lx]\n", (uint32_t)addr);
+    if ((addr + (EXTERNAL_FLASH_BLOCK_SIZE)) > (EXTERNAL_FLASH_SIZE) || ((addr % (EXTERNAL_FLASH_BLOCK_SIZE)) != 0)) {
+        dprintf("Flash erase block address over limit! [addr:0x%08" PRIx32 "]\n", (uint32_t)addr);
         return FLASH_STATUS_ERROR;
     }
 
@@ -293,6 +489,8 @@ flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
     uint8_t       *read_buf = (uint8_t *)buf;
 
+    spi_flash_async_drain();
+
     /* Wait for the write-in-progress bit to be cleared. */
     response = spi_flash_wait_while_busy();
     if (response != FLASH_STATUS_SUCCESS) {
@@ -324,6 +522,8 @@ flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len) {
     flash_status_t response  = FLASH_STATUS_SUCCESS;
     uint8_t       *write_buf = (uint8_t *)buf;
 
+    spi_flash_async_drain();
+
     while (len > 0) {
         uint32_t page_offset  = addr % EXTERNAL_FLASH_PAGE_SIZE;
         size_t   write_length = EXTERNAL_FLASH_PAGE_SIZE - page_offset;
@@ -93,6 +93,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define EXTERNAL_FLASH_SIZE (512 * 1024L)
 #endif
 
+/*
+    The number of asynchronous writes and erases that can be queued at once.
+*/
+#ifndef EXTERNAL_FLASH_ASYNC_QUEUE_SIZE
+#    define EXTERNAL_FLASH_ASYNC_QUEUE_SIZE 4
+#endif
+
 /*
     The block count of the FLASH, calculated by total FLASH size and block size.
 */
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /**
  * \file
@@ -153,4 +154,32 @@ i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* dat
  */
 i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout);
 
+/**
+ * \brief Start sending multiple bytes to the selected I2C device, without waiting for the transfer to complete.
+ *
+ * The data must remain valid and unmodified until the transfer has completed, see `i2c_is_busy()`. Any transfer already in progress is waited upon first, as are all other I2C operations. On ChibiOS the transfer is performed by a background thread, which sleeps while the I2C peripheral works; other platforms transmit synchronously.
+ *
+ * \param address The 7-bit I2C address of the device.
+ * \param data A pointer to the data to transmit.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ * \param timeout The time in milliseconds to wait for a response from the target device.
+ *
+ * \return `I2C_STATUS_SUCCESS` if the transfer was started. Its outcome is returned by `i2c_wait()`.
+ */
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout);
+
+/**
+ * \brief Check whether an asynchronous transfer is still in progress.
+ *
+ * \return `true` if a transfer started with `i2c_transmit_async()` has not yet completed.
+ */
+bool i2c_is_busy(void);
+
+/**
+ * \brief Wait for any asynchronous transfer to complete.
+ *
+ * \return `I2C_STATUS_TIMEOUT` if the last asynchronous transfer timed out, `I2C_STATUS_ERROR` if some other error occurred, otherwise `I2C_STATUS_SUCCESS`.
+ */
+i2c_status_t i2c_wait(void);
+
 /** \} */
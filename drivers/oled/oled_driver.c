@@ -19,9 +19,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "spi_master.h"
 #elif defined(OLED_TRANSPORT_I2C)
 #    include "i2c_master.h"
-#    if defined(USE_I2C) && defined(SPLIT_KEYBOARD)
-#        include "keyboard.h"
-#    endif
+#endif
+#ifdef SPLIT_KEYBOARD
+#    include "keyboard.h"
 #endif
 
 #include "compiler_support.h"
@@ -29,6 +29,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include OLED_FONT_H
 #include "timer.h"
 #include "print.h"
+#include "util.h"
 #include <string.h>
 #include "progmem.h"
 #include "wait.h"
@@ -116,6 +117,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #define OLED_ALL_BLOCKS_MASK (((((OLED_BLOCK_TYPE)1 << (OLED_BLOCK_COUNT - 1)) - 1) << 1) | 1)
 
+// Only the changed part of a block is sent if the block can't wrap onto the next page
+#define OLED_BLOCKS_WITHIN_PAGE (OLED_DISPLAY_WIDTH % OLED_BLOCK_SIZE == 0)
+
 #define OLED_IC_HAS_HORIZONTAL_MODE (OLED_IC == OLED_IC_SSD1306)
 #define OLED_IC_COM_PINS_ARE_COLUMNS (OLED_IC == OLED_IC_SH1107)
 
@@ -158,6 +162,18 @@ uint8_t         oled_rotation_width = 0;
 uint8_t         oled_scroll_speed   = 0; // this holds the speed after being remapped to ssd1306 internal values
 uint8_t         oled_scroll_start   = 0;
 uint8_t         oled_scroll_end     = 7;
+
+// Range of bytes changed within each dirty block. An empty range (first > last) with the dirty bit set means the whole
+// block needs sending, which is also what a dirty bit set from outside the driver gets.
+typedef struct {
+    uint16_t first;
+    uint16_t last;
+} oled_dirty_range_t;
+static oled_dirty_range_t oled_dirty_range[OLED_BLOCK_COUNT];
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_MIRROR_ENABLE)
+// Blocks changed since they were last mirrored to the other half
+static OLED_BLOCK_TYPE oled_mirror_dirty = 0;
+#endif
 #if OLED_TIMEOUT > 0
 uint32_t oled_timeout;
 #endif
@@ -372,16 +388,51 @@ __attribute__((weak)) oled_rotation_t oled_init_user(oled_rotation_t rotation) {
     return rotation;
 }
 
+static inline void oled_reset_dirty_range(uint8_t block) {
+    oled_dirty_range[block].first = UINT16_MAX;
+    oled_dirty_range[block].last  = 0;
+}
+
+// Marks the buffer bytes from first to last inclusive as changed, which may span several blocks
+static void oled_mark_dirty(uint16_t first, uint16_t last) {
+    for (uint8_t block = first / OLED_BLOCK_SIZE; block <= last / OLED_BLOCK_SIZE; ++block) {
+        OLED_BLOCK_TYPE     bit   = (OLED_BLOCK_TYPE)1 << block;
+        oled_dirty_range_t *range = &oled_dirty_range[block];
+        // A block that is already dirty with an empty range is sent whole anyway
+        if (!(oled_dirty & bit) || range->first <= range->last) {
+            uint16_t lo  = block == first / OLED_BLOCK_SIZE ? first % OLED_BLOCK_SIZE : 0;
+            uint16_t hi  = block == last / OLED_BLOCK_SIZE ? last % OLED_BLOCK_SIZE : OLED_BLOCK_SIZE - 1;
+            range->first = MIN(range->first, lo);
+            range->last  = MAX(range->last, hi);
+        }
+        oled_dirty |= bit;
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_MIRROR_ENABLE)
+        oled_mirror_dirty |= bit;
+#endif
+    }
+}
+
+static void oled_mark_all_dirty(void) {
+    for (uint8_t block = 0; block < OLED_BLOCK_COUNT; ++block) {
+        oled_reset_dirty_range(block);
+    }
+    oled_dirty = OLED_ALL_BLOCKS_MASK;
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_MIRROR_ENABLE)
+    oled_mirror_dirty = OLED_ALL_BLOCKS_MASK;
+#endif
+}
+
 void oled_clear(void) {
     memset(oled_buffer, 0, sizeof(oled_buffer));
     oled_cursor = &oled_buffer[0];
-    oled_dirty  = OLED_ALL_BLOCKS_MASK;
+    oled_mark_all_dirty();
 }
 
-static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
+// first and last are the range of bytes within the block to send, which must not cross a page unless it's the whole block
+static void calc_bounds(uint8_t update_start, uint16_t first, uint16_t last, uint8_t *cmd_array) {
     // Calculate commands to set memory addressing bounds.
     uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
-    uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH;
+    uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH + first;
 #if !OLED_IC_HAS_HORIZONTAL_MODE
     // Commands for Page Addressing Mode. Sets starting page and column; has no end bound.
     // Column value must be split into high and low nybble and sent as two commands.
@@ -390,10 +441,12 @@ static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
     cmd_array[2] = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
 #else
     // Commands for use in Horizontal Addressing mode.
+    uint16_t length = last - first + 1;
+
     cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
     cmd_array[4] = start_page;
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
+    cmd_array[2] = (length + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
+    cmd_array[5] = (length + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
 #endif
 }
 
@@ -442,10 +495,212 @@ static void rotate_90(const uint8_t *src, uint8_t *dest) {
     }
 }
 
+// Column & page position command for the block being rendered
+#if OLED_IC_HAS_HORIZONTAL_MODE
+static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+#else
+static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+#endif
+
+// For SH1106 or SH1107 rotated blocks must be split into separate pieces for each page, everything else is sent whole
+#if OLED_IC_HAS_HORIZONTAL_MODE
+#    define OLED_ROTATED_PIECE_SIZE OLED_BLOCK_SIZE
+#else
+#    define OLED_ROTATED_PIECE_SIZE ((OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8)
+#endif
+
+// Sets up the column & page position of a block, and returns its render data and length. Unrotated blocks only send
+// the bytes that changed since they were last rendered, rotated blocks are rotated whole into `temp_buffer`.
+static const uint8_t *oled_prepare_block(uint8_t block, uint8_t *temp_buffer, uint16_t *length) {
+    uint16_t first = oled_dirty_range[block].first;
+    uint16_t last  = oled_dirty_range[block].last;
+    oled_reset_dirty_range(block);
+    if (first > last || !OLED_BLOCKS_WITHIN_PAGE) {
+        first = 0;
+        last  = OLED_BLOCK_SIZE - 1;
+    }
+
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        calc_bounds(block, first, last, &display_start[1]); // Offset from I2C_CMD byte at the start
+        *length = last - first + 1;
+        return &oled_buffer[OLED_BLOCK_SIZE * block + first];
+    }
+
+    calc_bounds_90(block, &display_start[1]); // Offset from I2C_CMD byte at the start
+
+    // Rotate the render chunks
+    const static uint8_t source_map[] = OLED_SOURCE_MAP;
+    const static uint8_t target_map[] = OLED_TARGET_MAP;
+
+    memset(temp_buffer, 0, OLED_BLOCK_SIZE);
+    for (uint8_t i = 0; i < sizeof(source_map); ++i) {
+        rotate_90(&oled_buffer[OLED_BLOCK_SIZE * block + source_map[i]], &temp_buffer[target_map[i]]);
+    }
+    *length = OLED_BLOCK_SIZE;
+    return temp_buffer;
+}
+
+static inline uint16_t oled_block_piece_size(uint16_t length) {
+    return HAS_FLAGS(oled_rotation, OLED_ROTATION_90) ? OLED_ROTATED_PIECE_SIZE : length;
+}
+
+#ifdef OLED_ASYNC_RENDER
+// Background rendering sends one piece of a block at a time: its position command, then its data. Each step is started
+// by oled_render() and completes while the rest of the firmware runs, so the next call only has to check the outcome.
+enum { OLED_ASYNC_IDLE, OLED_ASYNC_COMMAND_SENT, OLED_ASYNC_DATA_SENT };
+
+static uint8_t  oled_async_state = OLED_ASYNC_IDLE;
+static uint8_t  oled_async_block;
+static uint8_t  oled_async_piece;
+static uint16_t oled_async_length;
+// Control byte followed by a snapshot of the block, so that the buffer can be drawn to while the transfer runs
+static uint8_t oled_async_packet[1 + OLED_BLOCK_SIZE];
+
+__attribute__((weak)) bool oled_send_async(const uint8_t *data, uint16_t size) {
+#    if defined(OLED_TRANSPORT_SPI)
+    if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
+        return false;
+    }
+    // Data or command mode, as per the control byte
+    if (data[0] == I2C_DATA) {
+        gpio_write_pin_high(OLED_DC_PIN);
+    } else {
+        gpio_write_pin_low(OLED_DC_PIN);
+    }
+    if (spi_transmit_async(&data[1], size - 1) != SPI_STATUS_SUCCESS) {
+        spi_stop();
+        return false;
+    }
+    spi_stop_async();
+    return true;
+#    elif defined(OLED_TRANSPORT_I2C)
+    return i2c_transmit_async((OLED_DISPLAY_ADDRESS << 1), data, size, OLED_I2C_TIMEOUT) == I2C_STATUS_SUCCESS;
+#    else
+    return data[0] == I2C_DATA ? oled_send_data(&data[1], size - 1) : oled_send_cmd(data, size);
+#    endif
+}
+
+__attribute__((weak)) bool oled_is_busy(void) {
+#    if defined(OLED_TRANSPORT_SPI)
+    return spi_is_busy();
+#    elif defined(OLED_TRANSPORT_I2C)
+    return i2c_is_busy();
+#    else
+    return false;
+#    endif
+}
+
+__attribute__((weak)) bool oled_wait_async(void) {
+#    if defined(OLED_TRANSPORT_SPI)
+    return spi_wait() == SPI_STATUS_SUCCESS;
+#    elif defined(OLED_TRANSPORT_I2C)
+    return i2c_wait() == I2C_STATUS_SUCCESS;
+#    else
+    return true;
+#    endif
+}
+
+// Sends the data of the current piece. Pieces after the first place their control byte over the last byte of the
+// previous piece, which has already been sent.
+static bool oled_async_send_piece(void) {
+    uint16_t piece_size = oled_block_piece_size(oled_async_length);
+    uint8_t *packet     = &oled_async_packet[piece_size * oled_async_piece];
+    packet[0]           = I2C_DATA;
+    return oled_send_async(packet, piece_size + 1);
+}
+
+// Advances background rendering by one step, returning false once there is nothing left to send
+static bool oled_async_step(void) {
+    bool ok = true;
+    switch (oled_async_state) {
+        case OLED_ASYNC_COMMAND_SENT:
+            ok               = oled_wait_async() && oled_async_send_piece();
+            oled_async_state = OLED_ASYNC_DATA_SENT;
+            break;
+        case OLED_ASYNC_DATA_SENT:
+            ok = oled_wait_async();
+            if (ok && ++oled_async_piece < oled_async_length / oled_block_piece_size(oled_async_length)) {
+                // Next page of a rotated SH1106 or SH1107 block
+                display_start[1]++;
+                ok               = oled_send_async(display_start, ARRAY_SIZE(display_start));
+                oled_async_state = OLED_ASYNC_COMMAND_SENT;
+                break;
+            }
+            oled_async_state = OLED_ASYNC_IDLE;
+            break;
+        default: {
+            oled_dirty &= OLED_ALL_BLOCKS_MASK;
+            if (!oled_dirty || oled_scrolling) {
+                return false;
+            }
+
+            // Turn on display if it is off
+            oled_on();
+
+            // Find next dirty block, and take a snapshot of it
+            oled_async_block = 0;
+            while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << oled_async_block))) {
+                ++oled_async_block;
+            }
+            const uint8_t *data = oled_prepare_block(oled_async_block, &oled_async_packet[1], &oled_async_length);
+            if (data != &oled_async_packet[1]) {
+                memcpy(&oled_async_packet[1], data, oled_async_length);
+            }
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << oled_async_block);
+
+            oled_async_piece = 0;
+            ok               = oled_send_async(display_start, ARRAY_SIZE(display_start));
+            oled_async_state = OLED_ASYNC_COMMAND_SENT;
+            break;
+        }
+    }
+
+    if (!ok) {
+        print("oled_render async transfer failed\n");
+        // Try the whole block again next time
+        oled_reset_dirty_range(oled_async_block);
+        oled_dirty |= ((OLED_BLOCK_TYPE)1 << oled_async_block);
+        oled_async_state = OLED_ASYNC_IDLE;
+        return false;
+    }
+    return true;
+}
+
+// Completes the block being sent in the background, if any
+static void oled_async_finish(void) {
+    while (oled_async_state != OLED_ASYNC_IDLE && oled_async_step()) {
+    }
+}
+#endif // OLED_ASYNC_RENDER
+
+// Whether there is rendering left to do, including any block still being sent in the background
+static inline bool oled_render_pending(void) {
+#ifdef OLED_ASYNC_RENDER
+    return oled_dirty || oled_async_state != OLED_ASYNC_IDLE;
+#else
+    return oled_dirty;
+#endif
+}
+
 void oled_render_dirty(bool all) {
+    if (!oled_initialized) {
+        return;
+    }
+
+#ifdef OLED_ASYNC_RENDER
+    if (!all) {
+        // Completion of the previous step is picked up on the next call, rather than waited for
+        if (!oled_is_busy()) {
+            oled_async_step();
+        }
+        return;
+    }
+    oled_async_finish();
+#endif
+
     // Do we have work to do?
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
-    if (!oled_dirty || !oled_initialized || oled_scrolling) {
+    if (!oled_dirty || oled_scrolling) {
         return;
     }
 
@@ -461,66 +716,24 @@ void oled_render_dirty(bool all) {
         }
 
         // Set column & page position
-#if OLED_IC_HAS_HORIZONTAL_MODE
-        static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
-#else
-        static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
-#endif
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        } else {
-            calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        }
-
-        // Send column & page position
-        if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-            print("oled_render offset command failed\n");
-            return;
-        }
-
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
-                print("oled_render data failed\n");
-                return;
-            }
-        } else {
-            // Rotate the render chunks
-            const static uint8_t source_map[] = OLED_SOURCE_MAP;
-            const static uint8_t target_map[] = OLED_TARGET_MAP;
-
-            static uint8_t temp_buffer[OLED_BLOCK_SIZE];
-            memset(temp_buffer, 0, sizeof(temp_buffer));
-            for (uint8_t i = 0; i < sizeof(source_map); ++i) {
-                rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
+        static uint8_t temp_buffer[OLED_BLOCK_SIZE];
+        uint16_t       length;
+        const uint8_t *data = oled_prepare_block(update_start, temp_buffer, &length);
+
+        // Send each piece of the block, preceded by its column & page position
+        const uint16_t piece_size = oled_block_piece_size(length);
+        for (uint16_t i = 0; i < length / piece_size; ++i) {
+            if (i > 0) {
+                display_start[1]++;
             }
-
-#if OLED_IC_HAS_HORIZONTAL_MODE
-            // Send render data chunk after rotating
-            if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
-                print("oled_render90 data failed\n");
+            if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+                print("oled_render offset command failed\n");
                 return;
             }
-#else
-            // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
-            const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
-            const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
-            for (uint8_t i = 0; i < num_pages; ++i) {
-                // Send column & page position for all pages except the first one
-                if (i > 0) {
-                    display_start[1]++;
-                    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-                        print("oled_render offset command failed\n");
-                        return;
-                    }
-                }
-                // Send data for the page
-                if (!oled_send_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
-                    print("oled_render90 data failed\n");
-                    return;
-                }
+            if (!oled_send_data(&data[piece_size * i], piece_size)) {
+                print("oled_render data failed\n");
+                return;
             }
-#endif
         }
 
         // Clear dirty flag of just rendered block
@@ -613,12 +826,18 @@ void oled_write_char(const char data, bool invert) {
         InvertCharacter(oled_cursor);
     }
 
-    // Dirty check
-    if (memcmp(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH)) {
+    // Dirty check, narrowed down to the columns that changed. The written data may span 2 blocks.
+    uint8_t first = 0;
+    while (first < OLED_FONT_WIDTH && oled_temp_buffer[first] == oled_cursor[first]) {
+        ++first;
+    }
+    if (first < OLED_FONT_WIDTH) {
+        uint8_t last = OLED_FONT_WIDTH - 1;
+        while (oled_temp_buffer[last] == oled_cursor[last]) {
+            --last;
+        }
         uint16_t index = oled_cursor - &oled_buffer[0];
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
-        // Edgecase check if the written data spans the 2 chunks
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((index + OLED_FONT_WIDTH - 1) / OLED_BLOCK_SIZE));
+        oled_mark_dirty(index + first, index + last);
     }
 
     // Finally move to the next char
@@ -653,7 +872,7 @@ void oled_pan(bool left) {
             }
         }
     }
-    oled_dirty = OLED_ALL_BLOCKS_MASK;
+    oled_mark_all_dirty();
 }
 
 oled_buffer_reader_t oled_read_raw(uint16_t start_index) {
@@ -668,18 +887,51 @@ void oled_write_raw_byte(const char data, uint16_t index) {
     if (index > OLED_MATRIX_SIZE) index = OLED_MATRIX_SIZE;
     if (oled_buffer[index] == data) return;
     oled_buffer[index] = data;
-    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+    oled_mark_dirty(index, index);
+}
+
+// Copies raw data into the buffer, only marking the bytes that differ as dirty. Unchanged data is skipped a word at a
+// time, as most raw writes redraw an image that is largely or entirely the same as what's already there.
+static void oled_copy_raw(uint16_t index, const uint8_t *data, uint16_t size) {
+    const uint16_t end   = index + size;
+    uint16_t       first = UINT16_MAX;
+    uint16_t       last  = 0;
+    while (index < end) {
+        uint8_t count = MIN((uint16_t)(end - index), sizeof(uint32_t));
+        if (count == sizeof(uint32_t)) {
+            uint32_t current, incoming;
+            memcpy(&current, &oled_buffer[index], sizeof(uint32_t));
+            memcpy(&incoming, data, sizeof(uint32_t));
+            if (current == incoming) {
+                index += sizeof(uint32_t);
+                data += sizeof(uint32_t);
+                continue;
+            }
+        }
+
+        for (; count > 0; --count, ++index, ++data) {
+            if (oled_buffer[index] == *data) continue;
+            oled_buffer[index] = *data;
+            // Changes are gathered up per block
+            if (first != UINT16_MAX && index / OLED_BLOCK_SIZE != first / OLED_BLOCK_SIZE) {
+                oled_mark_dirty(first, last);
+                first = UINT16_MAX;
+            }
+            if (first == UINT16_MAX) {
+                first = index;
+            }
+            last = index;
+        }
+    }
+    if (first != UINT16_MAX) {
+        oled_mark_dirty(first, last);
+    }
 }
 
 void oled_write_raw(const char *data, uint16_t size) {
     uint16_t cursor_start_index = oled_cursor - &oled_buffer[0];
     if ((size + cursor_start_index) > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - cursor_start_index;
-    for (uint16_t i = cursor_start_index; i < cursor_start_index + size; i++) {
-        uint8_t c = *data++;
-        if (oled_buffer[i] == c) continue;
-        oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
-    }
+    oled_copy_raw(cursor_start_index, (const uint8_t *)data, size);
 }
 
 void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
@@ -698,7 +950,7 @@ void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
     }
     if (oled_buffer[index] != data) {
         oled_buffer[index] = data;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+        oled_mark_dirty(index, index);
     }
 }
 
@@ -719,15 +971,45 @@ void oled_write_ln_P(const char *data, bool invert) {
 void oled_write_raw_P(const char *data, uint16_t size) {
     uint16_t cursor_start_index = oled_cursor - &oled_buffer[0];
     if ((size + cursor_start_index) > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - cursor_start_index;
-    for (uint16_t i = cursor_start_index; i < cursor_start_index + size; i++) {
-        uint8_t c = pgm_read_byte(data++);
-        if (oled_buffer[i] == c) continue;
-        oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+    // Compare in chunks read out of flash
+    uint8_t chunk[16];
+    for (uint16_t i = 0; i < size; i += sizeof(chunk)) {
+        uint8_t count = MIN((uint16_t)(size - i), sizeof(chunk));
+        memcpy_P(chunk, &data[i], count);
+        oled_copy_raw(cursor_start_index + i, chunk, count);
     }
 }
 #endif // defined(__AVR__)
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_MIRROR_ENABLE)
+bool oled_mirror_get_block(uint8_t *block, uint8_t *data) {
+    oled_mirror_dirty &= OLED_ALL_BLOCKS_MASK;
+    if (!oled_mirror_dirty) {
+        return false;
+    }
+
+    uint8_t next = 0;
+    while (!(oled_mirror_dirty & ((OLED_BLOCK_TYPE)1 << next))) {
+        ++next;
+    }
+    memcpy(data, &oled_buffer[OLED_BLOCK_SIZE * next], OLED_BLOCK_SIZE);
+    oled_mirror_dirty &= ~((OLED_BLOCK_TYPE)1 << next);
+    *block = next;
+    return true;
+}
+
+void oled_mirror_all(void) {
+    oled_mirror_dirty = OLED_ALL_BLOCKS_MASK;
+}
+
+void oled_mirror_set_block(uint8_t block, const uint8_t *data) {
+    if (block >= OLED_BLOCK_COUNT) {
+        return;
+    }
+    oled_copy_raw(OLED_BLOCK_SIZE * block, data, OLED_BLOCK_SIZE);
+}
+#endif // defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_MIRROR_ENABLE)
+
 bool oled_on(void) {
     if (!oled_initialized) {
         return oled_active;
@@ -832,7 +1114,7 @@ bool oled_scroll_right(void) {
 
     // Dont enable scrolling if we need to update the display
     // This prevents scrolling of bad data from starting the scroll too early after init
-    if (!oled_dirty && !oled_scrolling) {
+    if (!oled_render_pending() && !oled_scrolling) {
         uint8_t display_scroll_right[] = {I2C_CMD, SCROLL_RIGHT, 0x00, oled_scroll_start, oled_scroll_speed, oled_scroll_end, 0x00, 0xFF, ACTIVATE_SCROLL};
         if (!oled_send_cmd(display_scroll_right, ARRAY_SIZE(display_scroll_right))) {
             print("oled_scroll_right cmd failed\n");
@@ -850,7 +1132,7 @@ bool oled_scroll_left(void) {
 
     // Dont enable scrolling if we need to update the display
     // This prevents scrolling of bad data from starting the scroll too early after init
-    if (!oled_dirty && !oled_scrolling) {
+    if (!oled_render_pending() && !oled_scrolling) {
         uint8_t display_scroll_left[] = {I2C_CMD, SCROLL_LEFT, 0x00, oled_scroll_start, oled_scroll_speed, oled_scroll_end, 0x00, 0xFF, ACTIVATE_SCROLL};
         if (!oled_send_cmd(display_scroll_left, ARRAY_SIZE(display_scroll_left))) {
             print("oled_scroll_left cmd failed\n");
@@ -873,7 +1155,7 @@ bool oled_scroll_off(void) {
             return oled_scrolling;
         }
         oled_scrolling = false;
-        oled_dirty     = OLED_ALL_BLOCKS_MASK;
+        oled_mark_all_dirty();
     }
     return !oled_scrolling;
 }
@@ -920,21 +1202,32 @@ uint8_t oled_max_lines(void) {
     return OLED_DISPLAY_WIDTH / OLED_FONT_HEIGHT;
 }
 
+static inline bool oled_task_draws(void) {
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_MIRROR_ENABLE)
+    // Only the master draws, the slave's buffer is mirrored from it
+    return is_keyboard_master();
+#else
+    return true;
+#endif
+}
+
 void oled_task(void) {
     if (!oled_initialized) {
         return;
     }
 
+    if (oled_task_draws()) {
 #if OLED_UPDATE_INTERVAL > 0
-    if (timer_elapsed(oled_update_timeout) >= OLED_UPDATE_INTERVAL) {
-        oled_update_timeout = timer_read();
+        if (timer_elapsed(oled_update_timeout) >= OLED_UPDATE_INTERVAL) {
+            oled_update_timeout = timer_read();
+            oled_set_cursor(0, 0);
+            oled_task_kb();
+        }
+#else
         oled_set_cursor(0, 0);
         oled_task_kb();
-    }
-#else
-    oled_set_cursor(0, 0);
-    oled_task_kb();
 #endif
+    }
 
 #if OLED_SCROLL_TIMEOUT > 0
     if (oled_dirty && oled_scrolling) {
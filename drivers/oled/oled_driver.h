@@ -330,6 +330,14 @@ bool oled_init(oled_rotation_t rotation);
 bool oled_send_cmd(const uint8_t *data, uint16_t size);
 bool oled_send_cmd_P(const uint8_t *data, uint16_t size);
 bool oled_send_data(const uint8_t *data, uint16_t size);
+#ifdef OLED_ASYNC_RENDER
+// Start sending to screen in the background. data[0] selects commands (0x00) or data (0x40), and the buffer must remain
+// unmodified until the transfer completes. oled_is_busy returns true until then, and oled_wait_async waits for it,
+// returning whether it succeeded.
+bool oled_send_async(const uint8_t *data, uint16_t size);
+bool oled_is_busy(void);
+bool oled_wait_async(void);
+#endif
 void oled_driver_init(void);
 
 // Called at the start of oled_init, weak function overridable by the user
@@ -413,6 +421,18 @@ void oled_write_raw_P(const char *data, uint16_t size);
 #    define oled_write_raw_P(data, size) oled_write_raw(data, size)
 #endif // defined(__AVR__)
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_MIRROR_ENABLE)
+// Copies the next block changed since it was last mirrored to the other half into data, which must hold
+// OLED_BLOCK_SIZE bytes, and stops tracking it. Returns false if no blocks have changed.
+bool oled_mirror_get_block(uint8_t *block, uint8_t *data);
+
+// Marks every block as needing to be mirrored, e.g. when the other half may have restarted
+void oled_mirror_all(void);
+
+// Writes a block mirrored from the other half into the buffer, only marking the bytes that differ as dirty
+void oled_mirror_set_block(uint8_t block, const uint8_t *data);
+#endif // defined(SPLIT_KEYBOARD) && defined(SPLIT_OLED_MIRROR_ENABLE)
+
 // Can be used to manually turn on the screen if it is off
 // Returns true if the screen was on or turns on
 bool oled_on(void);
@@ -5,6 +5,14 @@
 
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
+#    include "qp_draw.h"
+
+#    if QUANTUM_PAINTER_SPI_ASYNC
+// Anything smaller isn't worth the overhead of setting up a background transfer
+#        define QP_COMMS_SPI_ASYNC_MIN_BYTES 32
+// Largest single background transfer of a caller-owned buffer, within the limits of spi_transmit_async()
+#        define QP_COMMS_SPI_ASYNC_MAX_BYTES 32768
+#    endif // QUANTUM_PAINTER_SPI_ASYNC
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base SPI support
@@ -31,6 +39,26 @@ bool qp_comms_spi_start(painter_device_t device) {
 }
 
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
+#    if QUANTUM_PAINTER_SPI_ASYNC
+    // Pixel data is sent in the background, while drawing continues in the other half of the double buffer
+    if (data == qp_internal_global_pixdata_buffer && byte_count >= QP_COMMS_SPI_ASYNC_MIN_BYTES) {
+        spi_transmit_async(data, byte_count);
+        qp_internal_swap_pixdata_buffer();
+        return byte_count;
+    }
+
+    // Caller-owned buffers are sent in place, each piece queueing behind the one before it
+    if (data == qp_internal_async_pixdata_source && byte_count >= QP_COMMS_SPI_ASYNC_MIN_BYTES) {
+        const uint8_t *p = (const uint8_t *)data;
+        for (uint32_t sent = 0; sent < byte_count;) {
+            uint32_t bytes_this_loop = MIN(byte_count - sent, QP_COMMS_SPI_ASYNC_MAX_BYTES);
+            spi_transmit_async(p + sent, bytes_this_loop);
+            sent += bytes_this_loop;
+        }
+        return byte_count;
+    }
+#    endif // QUANTUM_PAINTER_SPI_ASYNC
+
     uint32_t       bytes_remaining = byte_count;
     const uint8_t *p               = (const uint8_t *)data;
     const uint32_t max_msg_length  = 1024;
@@ -46,18 +74,37 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
 }
 
 bool qp_comms_spi_stop(painter_device_t device) {
+#    if QUANTUM_PAINTER_SPI_ASYNC
+    // Chip select is released by the SPI driver once the final transfer completes
+    spi_stop_async();
+#    else
     painter_driver_t      *driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
     spi_stop();
     gpio_write_pin_high(comms_config->chip_select_pin);
+#    endif // QUANTUM_PAINTER_SPI_ASYNC
     return true;
 }
 
+#    if QUANTUM_PAINTER_SPI_ASYNC
+bool qp_comms_spi_busy(painter_device_t device) {
+    return spi_is_busy();
+}
+
+void qp_comms_spi_async_task(void) {
+    // Polling completes any transaction left open by the final background transfer of a drawing operation
+    spi_is_busy();
+}
+#    endif // QUANTUM_PAINTER_SPI_ASYNC
+
 const painter_comms_vtable_t spi_comms_vtable = {
     .comms_init  = qp_comms_spi_init,
     .comms_start = qp_comms_spi_start,
     .comms_send  = qp_comms_spi_send_data,
     .comms_stop  = qp_comms_spi_stop,
+#    if QUANTUM_PAINTER_SPI_ASYNC
+    .comms_busy  = qp_comms_spi_busy,
+#    endif // QUANTUM_PAINTER_SPI_ASYNC
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,6 +141,7 @@ bool qp_comms_spi_dc_reset_init(painter_device_t device) {
 uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
     painter_driver_t               *driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    spi_wait(); // D/C must not change while a background transfer is in flight
     gpio_write_pin_high(comms_config->dc_pin);
     return qp_comms_spi_send_data(device, data, byte_count);
 }
@@ -101,6 +149,7 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
 bool qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t               *driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    spi_wait(); // D/C must not change while a background transfer is in flight
     gpio_write_pin_low(comms_config->dc_pin);
     spi_write(cmd);
     return true;
@@ -139,6 +188,9 @@ const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+#        if QUANTUM_PAINTER_SPI_ASYNC
+            .comms_busy  = qp_comms_spi_busy,
+#        endif // QUANTUM_PAINTER_SPI_ASYNC
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
@@ -24,6 +24,11 @@ bool     qp_comms_spi_start(painter_device_t device);
 uint32_t qp_comms_spi_send_data(painter_device_t device, const void* data, uint32_t byte_count);
 bool     qp_comms_spi_stop(painter_device_t device);
 
+#    if QUANTUM_PAINTER_SPI_ASYNC
+bool qp_comms_spi_busy(painter_device_t device);
+void qp_comms_spi_async_task(void);
+#    endif // QUANTUM_PAINTER_SPI_ASYNC
+
 extern const painter_comms_vtable_t spi_comms_vtable;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
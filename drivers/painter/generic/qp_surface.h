@@ -21,6 +21,30 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_NUM_DIRTY_RECTS
+/**
+ * @def This controls the number of separate dirty rectangles tracked by each surface.
+ *      Disjoint updates are transferred as separate regions instead of one bounding box covering them all.
+ *      Setting this to 1 reverts to a single bounding box.
+ */
+#    define SURFACE_NUM_DIRTY_RECTS 4
+#endif
+
+#ifndef SURFACE_DIRTY_RECT_MERGE_COST
+/**
+ * @def The estimated cost, in pixels, of transferring an extra region to the target (viewport commands, chip select, etc.).
+ *      Dirty rectangles are merged whenever doing so transfers fewer than this many unchanged pixels.
+ */
+#    define SURFACE_DIRTY_RECT_MERGE_COST 64
+#endif
+
+#ifndef SURFACE_COMPOSE_MAX_LAYERS
+/**
+ * @def This controls the maximum number of layers that can be blended together by qp_surface_compose.
+ */
+#    define SURFACE_COMPOSE_MAX_LAYERS 4
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -63,15 +87,49 @@ painter_device_t qp_make_rgb888_surface(uint16_t panel_width, uint16_t panel_hei
 /**
  * Helper method to draw the contents of the framebuffer to the target device.
  *
- * After successful completion, the dirty area is reset.
+ * Only the dirty regions are transferred, each with its own viewport. After successful completion, the dirty area is reset.
  *
  * @param surface[in] the surface to copy from
  * @param target[in] the target device to copy into
  * @param x[in] the x-location of the original position of the framebuffer
  * @param y[in] the y-location of the original position of the framebuffer
- * @param entire_surface[in] whether the entire surface should be drawn, instead of just the dirty region
+ * @param entire_surface[in] whether the entire surface should be drawn, instead of just the dirty regions
  * @return whether the draw operation completed successfully
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * A single layer of a composition, as used by \ref qp_surface_compose.
+ */
+typedef struct qp_surface_layer_t {
+    painter_device_t surface; ///< The surface holding the layer's pixels
+    uint16_t         x;       ///< The x-position of the layer within the composition, ignored for the first layer
+    uint16_t         y;       ///< The y-position of the layer within the composition, ignored for the first layer
+    uint8_t          alpha;   ///< The opacity of the layer, 0 (hidden) to 255 (opaque)
+    bool             keyed;   ///< Whether pixels matching the color key are transparent
+    uint8_t          key_hue; ///< The color key's hue, with 0-360 mapped to 0-255
+    uint8_t          key_sat; ///< The color key's saturation, with 0-100% mapped to 0-255
+    uint8_t          key_val; ///< The color key's value, with 0-100% mapped to 0-255
+} qp_surface_layer_t;
+
+/**
+ * Blends a stack of surfaces together and draws the result to the target device.
+ *
+ * The first layer is the background, and sets the size of the composition. Each subsequent layer is drawn on top of
+ * the ones before it, at its own position, with its own opacity and optional color key. Only the regions that are dirty
+ * in at least one layer are composited and transferred. After successful completion, the dirty area of every layer is
+ * reset.
+ *
+ * All layers and the target must share the same RGB565 or RGB888 native pixel format.
+ *
+ * @param target[in] the target device to draw into
+ * @param x[in] the x-location of the composition on the target
+ * @param y[in] the y-location of the composition on the target
+ * @param layers[in] the layers to composite, bottom-most first
+ * @param layer_count[in] the number of layers
+ * @param entire_surface[in] whether the entire composition should be drawn, such as after moving a layer or changing its opacity
+ * @return whether the draw operation completed successfully
+ */
+bool qp_surface_compose(painter_device_t target, uint16_t x, uint16_t y, const qp_surface_layer_t *layers, uint8_t layer_count, bool entire_surface);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -29,24 +29,174 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
-void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+static inline uint32_t dirty_rect_area(const surface_dirty_rect_t *rect) {
+    return ((uint32_t)(rect->r - rect->l) + 1) * ((uint32_t)(rect->b - rect->t) + 1);
+}
+
+static inline void dirty_rect_union(surface_dirty_rect_t *dest, const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    dest->l = MIN(a->l, b->l);
+    dest->t = MIN(a->t, b->t);
+    dest->r = MAX(a->r, b->r);
+    dest->b = MAX(a->b, b->b);
+}
+
+// Number of pixels that would be transferred needlessly if the two rectangles were merged
+static uint32_t dirty_rect_merge_waste(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    surface_dirty_rect_t merged;
+    dirty_rect_union(&merged, a, b);
+    uint32_t separate = dirty_rect_area(a) + dirty_rect_area(b);
+
+    // Overlapping pixels would otherwise be transferred twice
+    if (a->l <= b->r && b->l <= a->r && a->t <= b->b && b->t <= a->b) {
+        surface_dirty_rect_t overlap = {.l = MAX(a->l, b->l), .t = MAX(a->t, b->t), .r = MIN(a->r, b->r), .b = MIN(a->b, b->b)};
+        separate -= dirty_rect_area(&overlap);
+    }
+
+    uint32_t area = dirty_rect_area(&merged);
+    return area > separate ? area - separate : 0;
+}
+
+static void dirty_rect_remove(surface_dirty_data_t *dirty, uint8_t index) {
+    dirty->rects[index] = dirty->rects[--dirty->rect_count];
+}
+
+// Merges any rectangles that have become close enough to the one at the supplied index
+static void dirty_rect_coalesce(surface_dirty_data_t *dirty, uint8_t index) {
+    bool merged;
+    do {
+        merged = false;
+        for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+            if (i != index && dirty_rect_merge_waste(&dirty->rects[index], &dirty->rects[i]) <= SURFACE_DIRTY_RECT_MERGE_COST) {
+                dirty_rect_union(&dirty->rects[index], &dirty->rects[index], &dirty->rects[i]);
+                // The last rectangle gets moved into the removed slot, so follow it if that's the one we're growing
+                if (index == dirty->rect_count - 1) {
+                    index = i;
+                }
+                dirty_rect_remove(dirty, i);
+                merged = true;
+                break;
+            }
+        }
+    } while (merged);
+}
+
+// Finds the rectangle that needs to grow the least to cover the supplied one
+static uint8_t dirty_rect_closest(surface_dirty_data_t *dirty, const surface_dirty_rect_t *rect, uint32_t *cost) {
+    uint8_t closest = 0;
+    *cost           = UINT32_MAX;
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        uint32_t waste = dirty_rect_merge_waste(&dirty->rects[i], rect);
+        if (waste < *cost) {
+            closest = i;
+            *cost   = waste;
+        }
+    }
+    return closest;
+}
+
+// Merges the closest pair of rectangles to free up a slot, if that's cheaper than the supplied cost
+static void dirty_rect_merge_closest_pair(surface_dirty_data_t *dirty, uint32_t max_waste) {
+    uint8_t  pair_a     = 0;
+    uint8_t  pair_b     = 0;
+    uint32_t pair_waste = UINT32_MAX;
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        for (uint8_t j = i + 1; j < dirty->rect_count; ++j) {
+            uint32_t waste = dirty_rect_merge_waste(&dirty->rects[i], &dirty->rects[j]);
+            if (waste < pair_waste) {
+                pair_a     = i;
+                pair_b     = j;
+                pair_waste = waste;
+            }
+        }
+    }
+
+    if (pair_waste < max_waste) {
+        dirty_rect_union(&dirty->rects[pair_a], &dirty->rects[pair_a], &dirty->rects[pair_b]);
+        dirty_rect_remove(dirty, pair_b);
+        dirty_rect_coalesce(dirty, pair_a);
+    }
+}
+
+void qp_surface_update_dirty_rect(surface_dirty_data_t *dirty, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
     // Maintain dirty region
-    if (dirty->l > x) {
-        dirty->l        = x;
+    if (dirty->l > l) {
+        dirty->l        = l;
         dirty->is_dirty = true;
     }
-    if (dirty->r < x) {
-        dirty->r        = x;
+    if (dirty->r < r) {
+        dirty->r        = r;
         dirty->is_dirty = true;
     }
-    if (dirty->t > y) {
-        dirty->t        = y;
+    if (dirty->t > t) {
+        dirty->t        = t;
         dirty->is_dirty = true;
     }
-    if (dirty->b < y) {
-        dirty->b        = y;
+    if (dirty->b < b) {
+        dirty->b        = b;
         dirty->is_dirty = true;
     }
+
+    // Nothing else to do if the area is already covered by a dirty rectangle
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        if (l >= dirty->rects[i].l && r <= dirty->rects[i].r && t >= dirty->rects[i].t && b <= dirty->rects[i].b) {
+            return;
+        }
+    }
+
+    surface_dirty_rect_t area = {.l = l, .t = t, .r = r, .b = b};
+    uint32_t             cost;
+    uint8_t              closest = dirty_rect_closest(dirty, &area, &cost);
+
+    // If we're out of rectangles, merging the closest pair may be cheaper than growing one to reach the area
+    if (cost > SURFACE_DIRTY_RECT_MERGE_COST && dirty->rect_count == SURFACE_NUM_DIRTY_RECTS) {
+        dirty_rect_merge_closest_pair(dirty, cost);
+        closest = dirty_rect_closest(dirty, &area, &cost);
+    }
+
+    // Start a new rectangle if growing an existing one is too expensive, otherwise grow the closest
+    if (dirty->rect_count < SURFACE_NUM_DIRTY_RECTS && cost > SURFACE_DIRTY_RECT_MERGE_COST) {
+        dirty->rects[dirty->rect_count++] = area;
+    } else {
+        dirty_rect_union(&dirty->rects[closest], &dirty->rects[closest], &area);
+        dirty_rect_coalesce(dirty, closest);
+    }
+}
+
+void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+    qp_surface_update_dirty_rect(dirty, x, y, x, y);
+}
+
+uint8_t qp_surface_get_dirty_regions(surface_painter_device_t *surface, bool entire_surface, surface_dirty_rect_t *regions) {
+    surface_dirty_data_t *dirty       = &surface->dirty;
+    surface_dirty_rect_t  bounding    = {.l = dirty->l, .t = dirty->t, .r = dirty->r, .b = dirty->b};
+    uint32_t              rects_total = 0;
+
+    if (entire_surface) {
+        regions[0] = (surface_dirty_rect_t){.l = 0, .t = 0, .r = surface->base.panel_width - 1, .b = surface->base.panel_height - 1};
+        return 1;
+    }
+
+    if (dirty->rect_count == 0) {
+        return 0;
+    }
+
+    // If the separate regions (plus their overhead) end up costing more than the bounding box, just send the bounding box
+    for (uint8_t i = 0; i < dirty->rect_count; ++i) {
+        rects_total += dirty_rect_area(&dirty->rects[i]) + (i > 0 ? SURFACE_DIRTY_RECT_MERGE_COST : 0);
+    }
+    if (rects_total >= dirty_rect_area(&bounding)) {
+        regions[0] = bounding;
+        return 1;
+    }
+
+    memcpy(regions, dirty->rects, sizeof(surface_dirty_rect_t) * dirty->rect_count);
+    return dirty->rect_count;
+}
+
+void qp_surface_set_origin(painter_device_t device, uint16_t x, uint16_t y) {
+    surface_painter_device_t *surface = (surface_painter_device_t *)device;
+    surface->origin_x                 = x;
+    surface->origin_y                 = y;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,6 +213,9 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface->dirty.b        = surface->base.panel_height - 1;
     surface->dirty.is_dirty = true;
 
+    surface->dirty.rect_count = 1;
+    surface->dirty.rects[0]   = (surface_dirty_rect_t){.l = surface->dirty.l, .t = surface->dirty.t, .r = surface->dirty.r, .b = surface->dirty.b};
+
     return true;
 }
 
@@ -83,6 +236,7 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+    surface->dirty.rect_count           = 0;
     return true;
 }
 
@@ -0,0 +1,204 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+
+#    include "color.h"
+#    include "qp_draw.h"
+#    include "qp_surface_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Layer compositing
+
+typedef struct compose_layer_state_t {
+    surface_painter_device_t *surface;
+    surface_dirty_rect_t      extent; // area covered within the composition
+    uint8_t                   alpha;
+    bool                      keyed;
+    qp_pixel_t                key; // color key, in the layer's native format
+} compose_layer_state_t;
+
+static inline bool compose_covers(const surface_dirty_rect_t *extent, uint16_t x, uint16_t y) {
+    return x >= extent->l && x <= extent->r && y >= extent->t && y <= extent->b;
+}
+
+// Reads a layer's pixel as separate channels, at the panel's native precision. Returns false if the pixel is transparent.
+static inline bool compose_read(const compose_layer_state_t *layer, uint8_t bpp, uint16_t x, uint16_t y, rgb_t *out) {
+    if (!compose_covers(&layer->extent, x, y)) {
+        return false;
+    }
+
+    uint32_t offset = ((uint32_t)(y - layer->extent.t)) * layer->surface->base.panel_width + (x - layer->extent.l);
+    if (bpp == 16) {
+        uint16_t native = layer->surface->u16buffer[offset];
+        if (layer->keyed && native == layer->key.rgb565) {
+            return false;
+        }
+        native = __builtin_bswap16(native);
+        out->r = native >> 11;
+        out->g = (native >> 5) & 0x3F;
+        out->b = native & 0x1F;
+    } else {
+        rgb_t native = layer->surface->rgbbuffer[offset];
+        if (layer->keyed && native.r == layer->key.rgb888.r && native.g == layer->key.rgb888.g && native.b == layer->key.rgb888.b) {
+            return false;
+        }
+        *out = native;
+    }
+    return true;
+}
+
+static inline uint8_t compose_blend_channel(uint8_t below, uint8_t above, uint8_t alpha) {
+    // Exact division by 255 for the full range of products
+    uint16_t value = above * alpha + below * (255 - alpha);
+    return (value + 1 + (value >> 8)) >> 8;
+}
+
+static bool compose_region(painter_driver_t *target_driver, uint16_t x, uint16_t y, const compose_layer_state_t *layers, uint8_t layer_count, const surface_dirty_rect_t *region) {
+    uint8_t bpp = target_driver->native_bits_per_pixel;
+
+    // Anything below the topmost opaque, unkeyed layer covering the whole region can't be seen, so don't bother reading it
+    uint8_t first = 0;
+    for (uint8_t i = layer_count - 1; i > 0; --i) {
+        const surface_dirty_rect_t *extent = &layers[i].extent;
+        if (layers[i].alpha == 255 && !layers[i].keyed && extent->l <= region->l && extent->t <= region->t && extent->r >= region->r && extent->b >= region->b) {
+            first = i;
+            break;
+        }
+    }
+
+    bool ok = qp_viewport((painter_device_t)target_driver, x + region->l, y + region->t, x + region->r, y + region->b);
+    if (!ok) {
+        qp_dprintf("qp_surface_compose: fail (could not set target viewport)\n");
+        return false;
+    }
+
+    // Housekeeping of the amount of pixels to transfer
+    uint32_t total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / bpp;
+    uint32_t pixel_counter     = 0;
+
+    for (uint16_t cy = region->t; cy <= region->b; ++cy) {
+        for (uint16_t cx = region->l; cx <= region->r; ++cx) {
+            rgb_t result = {0};
+            for (uint8_t i = first; i < layer_count; ++i) {
+                rgb_t pixel;
+                if (layers[i].alpha == 0 || !compose_read(&layers[i], bpp, cx, cy, &pixel)) {
+                    continue;
+                }
+                if (layers[i].alpha == 255) {
+                    result = pixel;
+                } else {
+                    result.r = compose_blend_channel(result.r, pixel.r, layers[i].alpha);
+                    result.g = compose_blend_channel(result.g, pixel.g, layers[i].alpha);
+                    result.b = compose_blend_channel(result.b, pixel.b, layers[i].alpha);
+                }
+            }
+
+            if (bpp == 16) {
+                ((uint16_t *)qp_internal_global_pixdata_buffer)[pixel_counter++] = __builtin_bswap16(((uint16_t)result.r) << 11 | ((uint16_t)result.g) << 5 | result.b);
+            } else {
+                ((rgb_t *)qp_internal_global_pixdata_buffer)[pixel_counter++] = result;
+            }
+
+            // If we've accumulated enough data, send it. The global buffer may be swapped out while it's transmitted.
+            if (pixel_counter == total_pixel_count) {
+                if (!qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter)) {
+                    qp_dprintf("qp_surface_compose: fail (could not stream pixdata to target)\n");
+                    return false;
+                }
+                pixel_counter = 0;
+            }
+        }
+    }
+
+    // If there's any leftover data, send it
+    if (pixel_counter > 0 && !qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter)) {
+        qp_dprintf("qp_surface_compose: fail (could not stream pixdata to target)\n");
+        return false;
+    }
+
+    return true;
+}
+
+bool qp_surface_compose(painter_device_t target, uint16_t x, uint16_t y, const qp_surface_layer_t *layers, uint8_t layer_count, bool entire_surface) {
+    qp_dprintf("qp_surface_compose: entry\n");
+    painter_driver_t *target_driver = (painter_driver_t *)target;
+    if (!target_driver || !target_driver->validate_ok) {
+        qp_dprintf("qp_surface_compose: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (layer_count == 0 || layer_count > SURFACE_COMPOSE_MAX_LAYERS) {
+        qp_dprintf("qp_surface_compose: fail (invalid layer count %d)\n", (int)layer_count);
+        return false;
+    }
+
+    if (target_driver->native_bits_per_pixel != 16 && target_driver->native_bits_per_pixel != 24) {
+        qp_dprintf("qp_surface_compose: fail (unsupported bpp %d)\n", (int)target_driver->native_bits_per_pixel);
+        return false;
+    }
+
+    // Work out where each layer sits, and convert the color keys to native pixels for direct comparison
+    compose_layer_state_t states[SURFACE_COMPOSE_MAX_LAYERS];
+    for (uint8_t i = 0; i < layer_count; ++i) {
+        surface_painter_device_t *surface = (surface_painter_device_t *)layers[i].surface;
+        if (!surface || !surface->base.validate_ok || surface->base.native_bits_per_pixel != target_driver->native_bits_per_pixel) {
+            qp_dprintf("qp_surface_compose: fail (layer %d invalid, or incompatible with target)\n", (int)i);
+            return false;
+        }
+
+        uint16_t l       = i == 0 ? 0 : layers[i].x;
+        uint16_t t       = i == 0 ? 0 : layers[i].y;
+        states[i]        = (compose_layer_state_t){.surface = surface, .alpha = layers[i].alpha, .keyed = layers[i].keyed};
+        states[i].extent = (surface_dirty_rect_t){.l = l, .t = t, .r = l + surface->base.panel_width - 1, .b = t + surface->base.panel_height - 1};
+        if (states[i].keyed) {
+            states[i].key.hsv888 = (hsv_t){.h = layers[i].key_hue, .s = layers[i].key_sat, .v = layers[i].key_val};
+            surface->base.driver_vtable->palette_convert(layers[i].surface, 1, &states[i].key);
+        }
+    }
+
+    // Gather the dirty regions of every layer, in composition coordinates, merging them as a surface would
+    const surface_dirty_rect_t *bounds = &states[0].extent;
+    surface_dirty_data_t        dirty  = {.l = UINT16_MAX, .t = UINT16_MAX};
+    if (entire_surface) {
+        qp_surface_update_dirty_rect(&dirty, bounds->l, bounds->t, bounds->r, bounds->b);
+    } else {
+        for (uint8_t i = 0; i < layer_count; ++i) {
+            // Changes to hidden layers can't be seen
+            if (states[i].alpha == 0) {
+                continue;
+            }
+
+            surface_dirty_rect_t regions[SURFACE_NUM_DIRTY_RECTS];
+            uint8_t              region_count = qp_surface_get_dirty_regions(states[i].surface, false, regions);
+            for (uint8_t j = 0; j < region_count; ++j) {
+                uint16_t l = states[i].extent.l + regions[j].l;
+                uint16_t t = states[i].extent.t + regions[j].t;
+                uint16_t r = MIN(states[i].extent.l + regions[j].r, bounds->r);
+                uint16_t b = MIN(states[i].extent.t + regions[j].b, bounds->b);
+                if (l <= r && t <= b) {
+                    qp_surface_update_dirty_rect(&dirty, l, t, r, b);
+                }
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < dirty.rect_count; ++i) {
+        if (!compose_region(target_driver, x, y, states, layer_count, &dirty.rects[i])) {
+            return false;
+        }
+    }
+
+    // Clear the dirty info for every layer
+    for (uint8_t i = 0; i < layer_count; ++i) {
+        if (!qp_flush(layers[i].surface)) {
+            qp_dprintf("qp_surface_compose: fail (could not flush layer %d)\n", (int)i);
+            return false;
+        }
+    }
+
+    qp_dprintf("qp_surface_compose: ok\n");
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -16,12 +16,25 @@ typedef struct surface_painter_driver_vtable_t {
     bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
 } surface_painter_driver_vtable_t;
 
+typedef struct surface_dirty_rect_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} surface_dirty_rect_t;
+
 typedef struct surface_dirty_data_t {
-    bool     is_dirty;
+    bool is_dirty;
+
+    // Bounding box of all dirty rectangles
     uint16_t l;
     uint16_t t;
     uint16_t r;
     uint16_t b;
+
+    // Individual dirty rectangles, merged when they're close enough together
+    uint8_t              rect_count;
+    surface_dirty_rect_t rects[SURFACE_NUM_DIRTY_RECTS];
 } surface_dirty_data_t;
 
 typedef struct surface_viewport_data_t {
@@ -51,8 +64,12 @@ typedef struct surface_painter_device_t {
     // Manually manage the viewport for streaming pixel data to the display
     surface_viewport_data_t viewport;
 
-    // Maintain a dirty region so we can stream only what we need
+    // Maintain dirty regions so we can stream only what we need
     surface_dirty_data_t dirty;
+
+    // Drawing coordinates of the top-left pixel, so that a small surface can render one tile of a larger display
+    uint16_t origin_x;
+    uint16_t origin_y;
 } surface_painter_device_t;
 
 /**
@@ -90,6 +107,9 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+void qp_surface_update_dirty_rect(surface_dirty_data_t *dirty, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
+uint8_t qp_surface_get_dirty_regions(surface_painter_device_t *surface, bool entire_surface, surface_dirty_rect_t *regions);
+void qp_surface_set_origin(painter_device_t device, uint16_t x, uint16_t y);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
@@ -15,6 +15,10 @@ static inline void setpixel_mono1bpp(surface_painter_device_t *surface, uint16_t
     uint16_t w = surface->base.panel_width;
     uint16_t h = surface->base.panel_height;
 
+    // Translate to the surface's origin -- anything above or left of it wraps around, and is dropped as off-screen
+    x -= surface->origin_x;
+    y -= surface->origin_y;
+
     // Drop out if it's off-screen
     if (x >= w || y >= h) {
         return;
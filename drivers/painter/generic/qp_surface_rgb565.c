@@ -15,6 +15,10 @@ static inline void setpixel_rgb565(surface_painter_device_t *surface, uint16_t x
     uint16_t w = surface->base.panel_width;
     uint16_t h = surface->base.panel_height;
 
+    // Translate to the surface's origin -- anything above or left of it wraps around, and is dropped as off-screen
+    x -= surface->origin_x;
+    y -= surface->origin_y;
+
     // Drop out if it's off-screen
     if (x >= w || y >= h) {
         return;
@@ -68,13 +72,13 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool rgb565_target_pixdata_transfer_region(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, const surface_dirty_rect_t *region) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+    uint16_t l = region->l;
+    uint16_t t = region->t;
+    uint16_t r = region->r;
+    uint16_t b = region->b;
 
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
@@ -101,8 +105,9 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
                     qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
                     return false;
                 }
-                // Reset the counter
+                // Reset the counter, the global buffer may have been swapped out while the previous one is transmitted
                 pixel_counter = 0;
+                target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
             }
         }
     }
@@ -119,6 +124,21 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     return true;
 }
 
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    // Send each of the dirty regions separately, each with its own viewport
+    surface_dirty_rect_t regions[SURFACE_NUM_DIRTY_RECTS];
+    uint8_t              region_count = qp_surface_get_dirty_regions(surface_handle, entire_surface, regions);
+    for (uint8_t i = 0; i < region_count; ++i) {
+        if (!rgb565_target_pixdata_transfer_region(surface_driver, target_driver, x, y, &regions[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
     target_buffer[pixdata_offset] = pixdata_byte;
     return true;
@@ -109,6 +109,39 @@ spi_status_t spi_receive(uint8_t *data, uint16_t length);
  */
 void spi_stop(void);
 
+/**
+ * \brief Start sending multiple bytes to the selected SPI device, without waiting for the transfer to complete.
+ *
+ * The data must remain valid and unmodified until the transfer has completed, see `spi_is_busy()`. Any transfer already in progress is waited upon first, as are all other SPI operations. Platforms without DMA support transmit synchronously.
+ *
+ * \param data A pointer to the data to write from.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ *
+ * \return `SPI_STATUS_TIMEOUT` if the timeout period elapses, `SPI_STATUS_ERROR` if some other error occurs, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+/**
+ * \brief Check whether an asynchronous transfer is still in progress. Once it has completed, any stop requested through `spi_stop_async()` is carried out.
+ *
+ * \return `true` if a transfer started with `spi_transmit_async()` has not yet completed.
+ */
+bool spi_is_busy(void);
+
+/**
+ * \brief Wait for any asynchronous transfer to complete, carrying out any stop requested through `spi_stop_async()`.
+ *
+ * \return `SPI_STATUS_SUCCESS` once the bus is idle.
+ */
+spi_status_t spi_wait(void);
+
+/**
+ * \brief End the current SPI transaction once any asynchronous transfer has completed, without waiting for it.
+ *
+ * The transaction is ended by the first call to `spi_is_busy()` that observes the completed transfer, or by `spi_wait()` and `spi_start()`.
+ */
+void spi_stop_async(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,6 +42,24 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+bool backing_store_erase_partial(uint32_t address, uint32_t max_length, uint32_t *erased_length) {
+    *erased_length = 0;
+    if (address % (EXTERNAL_FLASH_SECTOR_SIZE) != 0 || max_length < (EXTERNAL_FLASH_SECTOR_SIZE)) {
+        return false;
+    }
+
+    uint32_t offset = (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + address;
+    bs_dprintf("Erase 0x%08lX\n", (unsigned long)offset);
+    if (flash_erase_sector(offset) != FLASH_STATUS_SUCCESS) {
+        return false;
+    }
+
+    *erased_length = (EXTERNAL_FLASH_SECTOR_SIZE);
+    return true;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
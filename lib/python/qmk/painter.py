@@ -454,3 +454,75 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+# LZ parameters, must match QGF_LZ_WINDOW_SIZE and QGF_LZ_MIN_MATCH in qgf.h
+LZ_WINDOW_SIZE = 1024
+LZ_MIN_MATCH = 4
+LZ_MAX_CANDIDATES = 64
+
+
+def compress_bytes_qmk_lz(bytearray):
+    data = bytes(bytearray)
+    output = []
+    chains = {}
+
+    def append_length(length):
+        # Lengths of 15 or more are continued in following bytes, until one is not 255
+        length -= 15
+        while length >= 255:
+            output.append(255)
+            length -= 255
+        output.append(length)
+
+    def append_sequence(literals, match_length=0, offset=0):
+        literal_count = len(literals)
+        match_code = max(match_length - LZ_MIN_MATCH, 0)
+        output.append((min(literal_count, 15) << 4) | min(match_code, 15))
+        if literal_count >= 15:
+            append_length(literal_count)
+        output.extend(literals)
+        if match_length > 0:
+            output.append(offset & 0xFF)
+            output.append(offset >> 8)
+            if match_code >= 15:
+                append_length(match_code)
+
+    def remember(pos):
+        if pos + LZ_MIN_MATCH <= len(data):
+            chain = chains.setdefault(data[pos:pos + LZ_MIN_MATCH], [])
+            chain.append(pos)
+            if len(chain) > LZ_MAX_CANDIDATES:
+                del chain[0]
+
+    literal_start = 0
+    pos = 0
+    while pos < len(data):
+        # Find the longest match within the window, matches may overlap the current position
+        best_length = 0
+        best_offset = 0
+        for candidate in reversed(chains.get(data[pos:pos + LZ_MIN_MATCH], [])):
+            if pos - candidate > LZ_WINDOW_SIZE:
+                break
+            length = LZ_MIN_MATCH
+            while pos + length < len(data) and data[candidate + length] == data[pos + length]:
+                length += 1
+            if length > best_length:
+                best_length = length
+                best_offset = pos - candidate
+
+        if best_length >= LZ_MIN_MATCH:
+            append_sequence(data[literal_start:pos], best_length, best_offset)
+            for n in range(pos, pos + best_length):
+                remember(n)
+            pos += best_length
+            literal_start = pos
+        else:
+            remember(pos)
+            pos += 1
+
+    # Any trailing literals form a final sequence without a match
+    if literal_start < len(data):
+        append_sequence(data[literal_start:])
+
+    return output
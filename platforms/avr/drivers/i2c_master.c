@@ -342,3 +342,20 @@ __attribute__((weak)) i2c_status_t i2c_ping_address(uint8_t address, uint16_t ti
     i2c_stop();
     return status;
 }
+
+// No DMA available, transfers complete before returning
+static i2c_status_t i2c_async_status = I2C_STATUS_SUCCESS;
+
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_status_t status = i2c_transmit(address, data, length, timeout);
+    i2c_async_status    = (status < 0) ? status : I2C_STATUS_SUCCESS;
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_is_busy(void) {
+    return false;
+}
+
+i2c_status_t i2c_wait(void) {
+    return i2c_async_status;
+}
@@ -198,3 +198,20 @@ void spi_stop(void) {
         current_slave_2x     = false;
     }
 }
+
+// No DMA available, transfers complete before returning
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    return spi_transmit(data, length);
+}
+
+bool spi_is_busy(void) {
+    return false;
+}
+
+spi_status_t spi_wait(void) {
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_stop_async(void) {
+    spi_stop();
+}
@@ -107,6 +107,25 @@ static const I2CConfig i2cconfig = {
 #endif
 };
 
+// Asynchronous transfer state. ChibiOS only offers blocking I2C transfers, so they are handed to a thread that sleeps
+// while the peripheral works, letting the main loop carry on.
+static volatile bool         i2cAsyncActive = false;
+static volatile i2c_status_t i2cAsyncStatus = I2C_STATUS_SUCCESS;
+static thread_t             *i2cAsyncThread = NULL;
+static binary_semaphore_t    i2cAsyncStart;
+static struct {
+    uint8_t        address;
+    const uint8_t* data;
+    uint16_t       length;
+    uint16_t       timeout;
+} i2cAsyncRequest;
+
+// Blocks until the in-flight asynchronous transfer, if any, has completed
+static inline void i2c_async_wait_transfer(void) {
+    while (i2cAsyncActive) {
+    }
+}
+
 /**
  * @brief Handles any I2C error condition by stopping the I2C peripheral and
  * aborting any ongoing transactions. Furthermore ChibiOS status codes are
@@ -149,24 +168,28 @@ __attribute__((weak)) void i2c_init(void) {
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait_transfer();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait_transfer();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_transmit_and_receive(uint8_t address, const uint8_t* tx_data, uint16_t tx_length, uint8_t* rx_data, uint16_t rx_length, uint16_t timeout) {
+    i2c_async_wait_transfer();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), tx_data, tx_length, rx_data, rx_length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait_transfer();
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
     uint8_t complete_packet[length + 1];
@@ -180,6 +203,7 @@ i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t*
 }
 
 i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait_transfer();
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
     uint8_t complete_packet[length + 2];
@@ -194,12 +218,14 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait_transfer();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait_transfer();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
     msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
@@ -213,3 +239,44 @@ __attribute__((weak)) i2c_status_t i2c_ping_address(uint8_t address, uint16_t ti
     uint8_t data = 0;
     return i2c_read_register(address, 0, &data, sizeof(data), timeout);
 }
+
+static THD_WORKING_AREA(waI2CAsyncThread, 256);
+static THD_FUNCTION(I2CAsyncThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_async");
+    while (true) {
+        chBSemWait(&i2cAsyncStart);
+        i2cStart(&I2C_DRIVER, &i2cconfig);
+        msg_t status   = i2cMasterTransmitTimeout(&I2C_DRIVER, (i2cAsyncRequest.address >> 1), i2cAsyncRequest.data, i2cAsyncRequest.length, 0, 0, TIME_MS2I(i2cAsyncRequest.timeout));
+        i2cAsyncStatus = i2c_epilogue(status);
+        i2cAsyncActive = false;
+    }
+}
+
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_wait_transfer();
+
+    if (i2cAsyncThread == NULL) {
+        chBSemObjectInit(&i2cAsyncStart, true);
+        i2cAsyncThread = chThdCreateStatic(waI2CAsyncThread, sizeof(waI2CAsyncThread), HIGHPRIO, I2CAsyncThread, NULL);
+    }
+
+    i2cAsyncRequest.address = address;
+    i2cAsyncRequest.data    = data;
+    i2cAsyncRequest.length  = length;
+    i2cAsyncRequest.timeout = timeout;
+    i2cAsyncActive          = true;
+
+    // The thread runs at a higher priority, so it starts the transfer before this returns
+    chBSemSignal(&i2cAsyncStart);
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_is_busy(void) {
+    return i2cAsyncActive;
+}
+
+i2c_status_t i2c_wait(void) {
+    i2c_async_wait_transfer();
+    return i2cAsyncStatus;
+}
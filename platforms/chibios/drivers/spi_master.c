@@ -65,6 +65,10 @@ static pin_t current_slave_pin     = NO_PIN;
 static bool  current_cs_active_low = true;
 #endif
 
+// Asynchronous transfer state
+static volatile bool spiAsyncActive  = false;
+static bool          spiStopDeferred = false;
+
 static SPIConfig spiConfig;
 
 static inline void spi_select(void) {
@@ -87,6 +91,18 @@ static inline void spi_unselect(void) {
     spiUnselect(&SPI_DRIVER);
 }
 
+// The driver state is updated from the SPI interrupt, so it has to be re-read on every poll
+static inline bool spi_async_transfer_active(void) {
+    return spiAsyncActive && ((volatile SPIDriver *)&SPI_DRIVER)->state == SPI_ACTIVE;
+}
+
+// Blocks until the in-flight asynchronous transfer, if any, has completed
+static inline void spi_async_wait_transfer(void) {
+    while (spi_async_transfer_active()) {
+    }
+    spiAsyncActive = false;
+}
+
 __attribute__((weak)) void spi_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -125,6 +141,9 @@ __attribute__((weak)) void spi_init(void) {
 }
 
 bool spi_start_extended(spi_start_config_t *start_config) {
+    // Complete any transaction whose end was deferred until its transfer finished
+    spi_wait();
+
 #if (SPI_USE_MUTUAL_EXCLUSION == TRUE)
     spiAcquireBus(&SPI_DRIVER);
 #endif // (SPI_USE_MUTUAL_EXCLUSION == TRUE)
@@ -437,6 +456,7 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 }
 
 spi_status_t spi_write(uint8_t data) {
+    spi_async_wait_transfer();
     uint8_t rxData;
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
@@ -444,6 +464,7 @@ spi_status_t spi_write(uint8_t data) {
 }
 
 spi_status_t spi_read(void) {
+    spi_async_wait_transfer();
     uint8_t data = 0;
     spiReceive(&SPI_DRIVER, 1, &data);
 
@@ -451,16 +472,21 @@ spi_status_t spi_read(void) {
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_async_wait_transfer();
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_async_wait_transfer();
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
+    spi_async_wait_transfer();
+    spiStopDeferred = false;
+
     if (spiStarted) {
         spi_unselect();
         spiStop(&SPI_DRIVER);
@@ -471,3 +497,33 @@ void spi_stop(void) {
     spiReleaseBus(&SPI_DRIVER);
 #endif // (SPI_USE_MUTUAL_EXCLUSION == TRUE)
 }
+
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_async_wait_transfer();
+    spiAsyncActive = true;
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_is_busy(void) {
+    if (spi_async_transfer_active()) {
+        return true;
+    }
+    spiAsyncActive = false;
+
+    if (spiStopDeferred) {
+        spi_stop();
+    }
+    return false;
+}
+
+spi_status_t spi_wait(void) {
+    while (spi_is_busy()) {
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_stop_async(void) {
+    spiStopDeferred = true;
+    spi_is_busy();
+}
@@ -134,6 +134,38 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+bool backing_store_erase_partial(uint32_t address, uint32_t max_length, uint32_t *erased_length) {
+    *erased_length = 0;
+
+    // Find the sector starting at the requested address -- sectors aren't necessarily uniformly sized
+    for (int i = 0; i < sector_count; ++i) {
+        if (flashGetSectorOffset(flash, first_sector + i) != base_offset + address) {
+            continue;
+        }
+
+        uint32_t sector_size = flashGetSectorSize(flash, first_sector + i);
+        if (sector_size > max_length) {
+            return false;
+        }
+
+        flash_error_t status = flashStartEraseSector(flash, first_sector + i);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            return false;
+        }
+        status = flashWaitErase(flash);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            return false;
+        }
+
+        *erased_length = sector_size;
+        return true;
+    }
+
+    return false;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = (base_offset + address);
     bs_dprintf("Write ");
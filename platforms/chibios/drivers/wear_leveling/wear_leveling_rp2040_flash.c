@@ -190,6 +190,22 @@ bool backing_store_erase(void) {
     return true;
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+bool backing_store_erase_partial(uint32_t address, uint32_t max_length, uint32_t *erased_length) {
+    *erased_length = 0;
+    if (address % (FLASH_SECTOR_SIZE) != 0 || max_length < (FLASH_SECTOR_SIZE)) {
+        return false;
+    }
+
+    interrupts = save_and_disable_interrupts();
+    flash_range_erase((WEAR_LEVELING_RP2040_FLASH_BASE) + address, (FLASH_SECTOR_SIZE));
+    restore_interrupts(interrupts);
+
+    *erased_length = (FLASH_SECTOR_SIZE);
+    return true;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
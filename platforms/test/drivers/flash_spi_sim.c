@@ -0,0 +1,207 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "flash_spi_sim.h"
+#include "flash_spi.h"
+#include "spi_master.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+
+#define FLASH_CMD_WRDI 0x04
+#define FLASH_CMD_RDSR 0x05
+#define FLASH_CMD_WREN 0x06
+#define FLASH_CMD_PP 0x02
+#define FLASH_CMD_READ 0x03
+#define FLASH_CMD_SE 0x20
+#define FLASH_CMD_BE 0xD8
+#define FLASH_CMD_CE 0x60
+
+#define FLASH_FLAG_WIP 0x01
+#define FLASH_FLAG_WEL 0x02
+
+static flash_spi_sim_config_t sim_config;
+static flash_spi_sim_stats_t  sim_stats;
+static uint8_t                sim_memory[EXTERNAL_FLASH_SIZE];
+static uint8_t                sim_page[EXTERNAL_FLASH_PAGE_SIZE];
+static uint32_t               pending_ns;
+static uint64_t               busy_until_us;
+static bool                   write_enabled;
+
+// Current transaction
+static bool     selected;
+static uint8_t  command;
+static uint32_t length;
+static uint32_t address;
+
+uint64_t flash_spi_sim_now_us(void) {
+    return (uint64_t)timer_read32() * 1000 + pending_ns / 1000;
+}
+
+static void flash_spi_sim_spend_ns(uint32_t ns) {
+    pending_ns += ns;
+    if (pending_ns >= 1000000) {
+        advance_time(pending_ns / 1000000);
+        pending_ns %= 1000000;
+    }
+}
+
+void flash_spi_sim_spend_us(uint32_t us) {
+    flash_spi_sim_spend_ns(us * 1000);
+}
+
+static bool flash_spi_sim_is_busy(void) {
+    return flash_spi_sim_now_us() < busy_until_us;
+}
+
+static void flash_spi_sim_set_busy(uint32_t us) {
+    busy_until_us = flash_spi_sim_now_us() + us;
+    write_enabled = false;
+}
+
+static void flash_spi_sim_erase(uint32_t addr, uint32_t size, uint32_t us) {
+    addr -= addr % size;
+    if (addr < EXTERNAL_FLASH_SIZE) {
+        memset(&sim_memory[addr], 0xFF, size);
+    }
+    sim_stats.erases++;
+    flash_spi_sim_set_busy(us);
+}
+
+// Clocks a single byte in both directions
+static uint8_t flash_spi_sim_exchange(uint8_t mosi) {
+    uint8_t miso = 0xFF;
+
+    uint32_t ns = 1000000000 / sim_config.bytes_per_sec;
+    sim_stats.bytes++;
+    sim_stats.bus_ns += ns;
+    flash_spi_sim_spend_ns(ns);
+
+    if (!selected) {
+        return miso;
+    }
+
+    if (length == 0) {
+        command = mosi;
+        if (command == FLASH_CMD_RDSR) {
+            sim_stats.status_polls++;
+        } else if (flash_spi_sim_is_busy()) {
+            sim_stats.busy_violations++;
+            command = 0;
+        }
+    } else if (command == FLASH_CMD_RDSR) {
+        miso = (flash_spi_sim_is_busy() ? FLASH_FLAG_WIP : 0) | (write_enabled ? FLASH_FLAG_WEL : 0);
+    } else if (length <= EXTERNAL_FLASH_ADDRESS_SIZE) {
+        address = (address << 8) | mosi;
+    } else if (command == FLASH_CMD_READ) {
+        miso = sim_memory[address % EXTERNAL_FLASH_SIZE];
+        address++;
+    } else if (command == FLASH_CMD_PP) {
+        // Data past the end of the page wraps around to its start, as on real parts
+        uint32_t offset = (address + length - EXTERNAL_FLASH_ADDRESS_SIZE - 1) % EXTERNAL_FLASH_PAGE_SIZE;
+        sim_page[offset] &= mosi;
+    }
+
+    length++;
+    return miso;
+}
+
+void flash_spi_sim_init(const flash_spi_sim_config_t *config) {
+    memcpy(&sim_config, config, sizeof(flash_spi_sim_config_t));
+    memset(&sim_stats, 0, sizeof(flash_spi_sim_stats_t));
+    memset(sim_memory, 0xFF, sizeof(sim_memory));
+    pending_ns    = 0;
+    busy_until_us = 0;
+    write_enabled = false;
+    selected      = false;
+}
+
+const flash_spi_sim_stats_t *flash_spi_sim_get_stats(void) {
+    return &sim_stats;
+}
+
+const uint8_t *flash_spi_sim_memory(void) {
+    return sim_memory;
+}
+
+void spi_init(void) {}
+
+bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    if (selected) {
+        sim_stats.nested_starts++;
+        return false;
+    }
+
+    selected = true;
+    command  = 0;
+    length   = 0;
+    address  = 0;
+    memset(sim_page, 0xFF, sizeof(sim_page));
+    sim_stats.transactions++;
+    return true;
+}
+
+spi_status_t spi_write(uint8_t data) {
+    flash_spi_sim_exchange(data);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_read(void) {
+    return flash_spi_sim_exchange(0);
+}
+
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    for (uint16_t i = 0; i < length; ++i) {
+        flash_spi_sim_exchange(data[i]);
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    for (uint16_t i = 0; i < length; ++i) {
+        data[i] = flash_spi_sim_exchange(0);
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+// Commands take effect when chip select is released
+void spi_stop(void) {
+    bool has_address = length > EXTERNAL_FLASH_ADDRESS_SIZE;
+    selected         = false;
+
+    switch (command) {
+        case FLASH_CMD_WREN:
+            write_enabled = true;
+            break;
+        case FLASH_CMD_WRDI:
+            write_enabled = false;
+            break;
+        case FLASH_CMD_PP:
+            if (write_enabled && has_address) {
+                uint32_t page = address - (address % EXTERNAL_FLASH_PAGE_SIZE);
+                for (uint32_t i = 0; i < EXTERNAL_FLASH_PAGE_SIZE; ++i) {
+                    sim_memory[(page + i) % EXTERNAL_FLASH_SIZE] &= sim_page[i];
+                }
+                sim_stats.page_programs++;
+                flash_spi_sim_set_busy(sim_config.page_program_us);
+            }
+            break;
+        case FLASH_CMD_SE:
+            if (write_enabled && has_address) {
+                flash_spi_sim_erase(address, EXTERNAL_FLASH_SECTOR_SIZE, sim_config.sector_erase_us);
+            }
+            break;
+        case FLASH_CMD_BE:
+            if (write_enabled && has_address) {
+                flash_spi_sim_erase(address, EXTERNAL_FLASH_BLOCK_SIZE, sim_config.block_erase_us);
+            }
+            break;
+        case FLASH_CMD_CE:
+            if (write_enabled) {
+                flash_spi_sim_erase(0, EXTERNAL_FLASH_SIZE, sim_config.chip_erase_us);
+            }
+            break;
+    }
+}
@@ -0,0 +1,64 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Simulated SPI NOR flash for the test platform.
+
+    Implements the `spi_master` API and decodes the command set used by
+    `flash_spi.c` (RDSR, WREN, WRDI, READ, PP, SE, BE, CE) against an
+    in-memory array of `EXTERNAL_FLASH_SIZE` bytes. Programming only ever
+    clears bits and erasing sets them, as on real NOR flash.
+
+    Every byte on the bus costs time according to the configured bandwidth,
+    and page programs and erases keep the write-in-progress bit set for the
+    configured duration. Time is advanced through the test platform timer,
+    so anything else the test does between SPI transactions (e.g. a matrix
+    scan) overlaps with the chip being busy. Commands other than RDSR sent
+    while the chip is busy are ignored, and counted as violations.
+*/
+
+typedef struct flash_spi_sim_config_t {
+    uint32_t bytes_per_sec;   // SPI bandwidth, must be non-zero so that polling advances time
+    uint32_t page_program_us; // duration of a page program
+    uint32_t sector_erase_us; // duration of a sector erase
+    uint32_t block_erase_us;  // duration of a block erase
+    uint32_t chip_erase_us;   // duration of a chip erase
+} flash_spi_sim_config_t;
+
+typedef struct flash_spi_sim_stats_t {
+    uint32_t transactions;
+    uint32_t status_polls;
+    uint32_t page_programs;
+    uint32_t erases;
+    uint32_t busy_violations; // commands other than RDSR received while busy
+    uint32_t nested_starts;   // spi_start() calls while another transaction already held the bus
+    uint32_t bytes;
+    uint64_t bus_ns;
+} flash_spi_sim_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Erases the whole simulated chip and resets the statistics
+void flash_spi_sim_init(const flash_spi_sim_config_t *config);
+
+const flash_spi_sim_stats_t *flash_spi_sim_get_stats(void);
+
+// Direct access to the simulated array, bypassing the bus
+const uint8_t *flash_spi_sim_memory(void);
+
+// Simulated time in microseconds
+uint64_t flash_spi_sim_now_us(void);
+
+// Spends time outside of the SPI bus, e.g. to model the rest of the main loop
+void flash_spi_sim_spend_us(uint32_t us);
+
+#ifdef __cplusplus
+}
+#endif
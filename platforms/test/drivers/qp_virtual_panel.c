@@ -0,0 +1,380 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdio.h>
+#include <string.h>
+
+#include "qp_virtual_panel.h"
+#include "qp_comms.h"
+#include "qp_tft_panel.h"
+
+// MIPI DCS opcodes understood by the virtual panel
+#define VPANEL_CMD_RESET 0x01
+#define VPANEL_CMD_SLEEP_OFF 0x11
+#define VPANEL_CMD_DISPLAY_OFF 0x28
+#define VPANEL_CMD_DISPLAY_ON 0x29
+#define VPANEL_SET_COL_ADDR 0x2A
+#define VPANEL_SET_ROW_ADDR 0x2B
+#define VPANEL_SET_MEM 0x2C
+#define VPANEL_SET_MADCTL 0x36
+#define VPANEL_SET_PIX_FMT 0x3A
+
+#define VPANEL_MADCTL_MY 0b10000000
+#define VPANEL_MADCTL_MX 0b01000000
+#define VPANEL_MADCTL_MV 0b00100000
+
+typedef struct qp_virtual_panel_device_t {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    uint8_t *gram;
+    bool     display_on;
+    uint8_t  madctl;
+
+    // Command currently being decoded, and its parameters received so far
+    uint8_t  command;
+    uint8_t  param_count;
+    uint8_t  params[4];
+    uint16_t col_start;
+    uint16_t col_end;
+    uint16_t row_start;
+    uint16_t row_end;
+
+    // Current write location in GRAM, and any partially received pixel
+    uint16_t col;
+    uint16_t row;
+    uint8_t  pixel[3];
+    uint8_t  pixel_fill;
+
+    qp_virtual_panel_stats_t stats;
+} qp_virtual_panel_device_t;
+
+static qp_virtual_panel_device_t qp_virtual_panel_drivers[QP_VIRTUAL_PANEL_NUM_DEVICES] = {0};
+
+static inline uint8_t qp_virtual_panel_bytes_per_pixel(qp_virtual_panel_device_t *panel) {
+    return panel->base.native_bits_per_pixel / 8;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// GRAM
+
+static void qp_virtual_panel_reset(qp_virtual_panel_device_t *panel) {
+    memset(panel->gram, 0, QP_VIRTUAL_PANEL_BUFFER_SIZE(panel->base.panel_width, panel->base.panel_height, panel->base.native_bits_per_pixel));
+    panel->display_on = false;
+    panel->madctl     = 0;
+    panel->col_start  = 0;
+    panel->col_end    = panel->base.panel_width - 1;
+    panel->row_start  = 0;
+    panel->row_end    = panel->base.panel_height - 1;
+}
+
+static void qp_virtual_panel_write_pixel(qp_virtual_panel_device_t *panel) {
+    // Column/row addresses are swapped by MV first, then mirrored within the physical GRAM
+    uint16_t x = (panel->madctl & VPANEL_MADCTL_MV) ? panel->row : panel->col;
+    uint16_t y = (panel->madctl & VPANEL_MADCTL_MV) ? panel->col : panel->row;
+    if (x >= panel->base.panel_width || y >= panel->base.panel_height) {
+        panel->stats.clipped_pixels++;
+    } else {
+        if (panel->madctl & VPANEL_MADCTL_MX) {
+            x = panel->base.panel_width - 1 - x;
+        }
+        if (panel->madctl & VPANEL_MADCTL_MY) {
+            y = panel->base.panel_height - 1 - y;
+        }
+        uint8_t bytes = qp_virtual_panel_bytes_per_pixel(panel);
+        memcpy(&panel->gram[((uint32_t)y * panel->base.panel_width + x) * bytes], panel->pixel, bytes);
+        panel->stats.pixels++;
+    }
+
+    // Advance through the window, wrapping back to the start like the real thing
+    if (++panel->col > panel->col_end) {
+        panel->col = panel->col_start;
+        if (++panel->row > panel->row_end) {
+            panel->row = panel->row_start;
+        }
+    }
+}
+
+static void qp_virtual_panel_receive_data(qp_virtual_panel_device_t *panel, uint8_t byte) {
+    switch (panel->command) {
+        case VPANEL_SET_COL_ADDR:
+        case VPANEL_SET_ROW_ADDR:
+            if (panel->param_count < sizeof(panel->params)) {
+                panel->params[panel->param_count++] = byte;
+            }
+            if (panel->param_count == sizeof(panel->params)) {
+                uint16_t start = ((uint16_t)panel->params[0]) << 8 | panel->params[1];
+                uint16_t end   = ((uint16_t)panel->params[2]) << 8 | panel->params[3];
+                if (panel->command == VPANEL_SET_COL_ADDR) {
+                    panel->col_start = start;
+                    panel->col_end   = end;
+                } else {
+                    panel->row_start = start;
+                    panel->row_end   = end;
+                }
+            }
+            break;
+        case VPANEL_SET_MEM:
+            panel->pixel[panel->pixel_fill++] = byte;
+            if (panel->pixel_fill == qp_virtual_panel_bytes_per_pixel(panel)) {
+                panel->pixel_fill = 0;
+                qp_virtual_panel_write_pixel(panel);
+            }
+            break;
+        case VPANEL_SET_MADCTL:
+            panel->madctl = byte;
+            break;
+        default:
+            // Parameters for commands without any effect on GRAM
+            break;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Comms
+
+static bool qp_virtual_panel_comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool qp_virtual_panel_comms_start(painter_device_t device) {
+    qp_virtual_panel_device_t *panel = (qp_virtual_panel_device_t *)device;
+    panel->stats.transactions++;
+    return true;
+}
+
+static bool qp_virtual_panel_comms_stop(painter_device_t device) {
+    return true;
+}
+
+static uint32_t qp_virtual_panel_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    qp_virtual_panel_device_t *panel = (qp_virtual_panel_device_t *)device;
+    const uint8_t             *p     = (const uint8_t *)data;
+    for (uint32_t i = 0; i < byte_count; ++i) {
+        qp_virtual_panel_receive_data(panel, p[i]);
+    }
+    panel->stats.data_bytes += byte_count;
+    return byte_count;
+}
+
+static bool qp_virtual_panel_comms_send_command(painter_device_t device, uint8_t cmd) {
+    qp_virtual_panel_device_t *panel = (qp_virtual_panel_device_t *)device;
+    panel->stats.commands++;
+    panel->command     = cmd;
+    panel->param_count = 0;
+
+    switch (cmd) {
+        case VPANEL_CMD_RESET:
+            qp_virtual_panel_reset(panel);
+            break;
+        case VPANEL_CMD_DISPLAY_ON:
+        case VPANEL_CMD_DISPLAY_OFF:
+            panel->display_on = cmd == VPANEL_CMD_DISPLAY_ON;
+            break;
+        case VPANEL_SET_MEM:
+            panel->col        = panel->col_start;
+            panel->row        = panel->row_start;
+            panel->pixel_fill = 0;
+            panel->stats.windows++;
+            break;
+    }
+    return true;
+}
+
+static bool qp_virtual_panel_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
+    // Same layout as the SPI implementation; delays are skipped as there's nothing to wait for
+    for (size_t i = 0; i < sequence_len;) {
+        uint8_t num_bytes = sequence[i + 2];
+        qp_virtual_panel_comms_send_command(device, sequence[i]);
+        if (num_bytes > 0) {
+            qp_virtual_panel_comms_send(device, &sequence[i + 3], num_bytes);
+        }
+        i += (3 + num_bytes);
+    }
+    return true;
+}
+
+static const painter_comms_with_command_vtable_t qp_virtual_panel_comms_vtable = {
+    .base =
+        {
+            .comms_init  = qp_virtual_panel_comms_init,
+            .comms_start = qp_virtual_panel_comms_start,
+            .comms_stop  = qp_virtual_panel_comms_stop,
+            .comms_send  = qp_virtual_panel_comms_send,
+        },
+    .send_command          = qp_virtual_panel_comms_send_command,
+    .bulk_command_sequence = qp_virtual_panel_comms_bulk_command_sequence,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Initialization
+
+static bool qp_virtual_panel_init(painter_device_t device, painter_rotation_t rotation) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    // clang-format off
+    const uint8_t init_sequence[] = {
+        // Command,              Delay, N, Data[N]
+        VPANEL_CMD_RESET,          120, 0,
+        VPANEL_CMD_SLEEP_OFF,        5, 0,
+        VPANEL_SET_PIX_FMT,          0, 1, driver->native_bits_per_pixel == 16 ? 0x55 : 0x66,
+        VPANEL_CMD_DISPLAY_ON,      20, 0
+    };
+    // clang-format on
+    if (!qp_comms_bulk_command_sequence(device, init_sequence, sizeof(init_sequence))) {
+        return false;
+    }
+
+    // Configure the rotation (i.e. the ordering and direction of memory writes in GRAM)
+    const uint8_t madctl[] = {
+        [QP_ROTATION_0]   = 0,
+        [QP_ROTATION_90]  = VPANEL_MADCTL_MX | VPANEL_MADCTL_MV,
+        [QP_ROTATION_180] = VPANEL_MADCTL_MX | VPANEL_MADCTL_MY,
+        [QP_ROTATION_270] = VPANEL_MADCTL_MV | VPANEL_MADCTL_MY,
+    };
+    return qp_comms_command_databyte(device, VPANEL_SET_MADCTL, madctl[rotation]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Driver vtables
+
+static const tft_panel_dc_reset_painter_driver_vtable_t qp_virtual_panel_rgb565_vtable = {
+    .base =
+        {
+            .init            = qp_virtual_panel_init,
+            .power           = qp_tft_panel_power,
+            .clear           = qp_tft_panel_clear,
+            .flush           = qp_tft_panel_flush,
+            .pixdata         = qp_tft_panel_pixdata,
+            .viewport        = qp_tft_panel_viewport,
+            .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
+            .append_pixels   = qp_tft_panel_append_pixels_rgb565,
+            .append_pixdata  = qp_tft_panel_append_pixdata,
+        },
+    .num_window_bytes   = 2,
+    .swap_window_coords = false,
+    .opcodes =
+        {
+            .display_on         = VPANEL_CMD_DISPLAY_ON,
+            .display_off        = VPANEL_CMD_DISPLAY_OFF,
+            .set_column_address = VPANEL_SET_COL_ADDR,
+            .set_row_address    = VPANEL_SET_ROW_ADDR,
+            .enable_writes      = VPANEL_SET_MEM,
+        },
+};
+
+static const tft_panel_dc_reset_painter_driver_vtable_t qp_virtual_panel_rgb888_vtable = {
+    .base =
+        {
+            .init            = qp_virtual_panel_init,
+            .power           = qp_tft_panel_power,
+            .clear           = qp_tft_panel_clear,
+            .flush           = qp_tft_panel_flush,
+            .pixdata         = qp_tft_panel_pixdata,
+            .viewport        = qp_tft_panel_viewport,
+            .palette_convert = qp_tft_panel_palette_convert_rgb888,
+            .append_pixels   = qp_tft_panel_append_pixels_rgb888,
+            .append_pixdata  = qp_tft_panel_append_pixdata,
+        },
+    .num_window_bytes   = 2,
+    .swap_window_coords = false,
+    .opcodes =
+        {
+            .display_on         = VPANEL_CMD_DISPLAY_ON,
+            .display_off        = VPANEL_CMD_DISPLAY_OFF,
+            .set_column_address = VPANEL_SET_COL_ADDR,
+            .set_row_address    = VPANEL_SET_ROW_ADDR,
+            .enable_writes      = VPANEL_SET_MEM,
+        },
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Factory and inspection
+
+painter_device_t qp_virtual_panel_make_device(uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel, void *buffer) {
+    if (bits_per_pixel != 16 && bits_per_pixel != 24) {
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < QP_VIRTUAL_PANEL_NUM_DEVICES; ++i) {
+        qp_virtual_panel_device_t *panel = &qp_virtual_panel_drivers[i];
+        if (!panel->base.driver_vtable) {
+            memset(panel, 0, sizeof(qp_virtual_panel_device_t));
+            panel->base.driver_vtable         = (const painter_driver_vtable_t *)(bits_per_pixel == 16 ? &qp_virtual_panel_rgb565_vtable : &qp_virtual_panel_rgb888_vtable);
+            panel->base.comms_vtable          = (const painter_comms_vtable_t *)&qp_virtual_panel_comms_vtable;
+            panel->base.panel_width           = panel_width;
+            panel->base.panel_height          = panel_height;
+            panel->base.rotation              = QP_ROTATION_0;
+            panel->base.offset_x              = 0;
+            panel->base.offset_y              = 0;
+            panel->base.native_bits_per_pixel = bits_per_pixel;
+            panel->gram                       = (uint8_t *)buffer;
+            qp_virtual_panel_reset(panel);
+            return (painter_device_t)panel;
+        }
+    }
+    return NULL;
+}
+
+void qp_virtual_panel_release(painter_device_t device) {
+    qp_virtual_panel_device_t *panel = (qp_virtual_panel_device_t *)device;
+    memset(panel, 0, sizeof(qp_virtual_panel_device_t));
+}
+
+const qp_virtual_panel_stats_t *qp_virtual_panel_get_stats(painter_device_t device) {
+    qp_virtual_panel_device_t *panel = (qp_virtual_panel_device_t *)device;
+    return &panel->stats;
+}
+
+void qp_virtual_panel_reset_stats(painter_device_t device) {
+    qp_virtual_panel_device_t *panel = (qp_virtual_panel_device_t *)device;
+    memset(&panel->stats, 0, sizeof(panel->stats));
+}
+
+uint32_t qp_virtual_panel_bus_bytes(painter_device_t device) {
+    qp_virtual_panel_device_t *panel = (qp_virtual_panel_device_t *)device;
+    return panel->stats.commands + panel->stats.data_bytes;
+}
+
+rgb_t qp_virtual_panel_get_pixel(painter_device_t device, uint16_t x, uint16_t y) {
+    qp_virtual_panel_device_t *panel = (qp_virtual_panel_device_t *)device;
+    uint8_t                    bytes = qp_virtual_panel_bytes_per_pixel(panel);
+    const uint8_t             *p     = &panel->gram[((uint32_t)y * panel->base.panel_width + x) * bytes];
+    if (bytes == 3) {
+        return (rgb_t){.r = p[0], .g = p[1], .b = p[2]};
+    }
+
+    // Expand RGB565 to 8 bits per channel by replicating the top bits into the bottom ones
+    uint16_t rgb565 = ((uint16_t)p[0]) << 8 | p[1];
+    uint8_t  r      = (rgb565 >> 11) & 0x1F;
+    uint8_t  g      = (rgb565 >> 5) & 0x3F;
+    uint8_t  b      = rgb565 & 0x1F;
+    return (rgb_t){.r = (r << 3) | (r >> 2), .g = (g << 2) | (g >> 4), .b = (b << 3) | (b >> 2)};
+}
+
+uint32_t qp_virtual_panel_hash(painter_device_t device) {
+    qp_virtual_panel_device_t *panel = (qp_virtual_panel_device_t *)device;
+    uint32_t                   size  = QP_VIRTUAL_PANEL_BUFFER_SIZE(panel->base.panel_width, panel->base.panel_height, panel->base.native_bits_per_pixel);
+    uint32_t                   hash  = 2166136261u;
+    for (uint32_t i = 0; i < size; ++i) {
+        hash = (hash ^ panel->gram[i]) * 16777619u;
+    }
+    return hash;
+}
+
+bool qp_virtual_panel_write_ppm(painter_device_t device, const char *filename) {
+    qp_virtual_panel_device_t *panel = (qp_virtual_panel_device_t *)device;
+    FILE                      *f     = fopen(filename, "wb");
+    if (!f) {
+        return false;
+    }
+
+    bool ok = fprintf(f, "P6\n%u %u\n255\n", panel->base.panel_width, panel->base.panel_height) > 0;
+    for (uint16_t y = 0; ok && y < panel->base.panel_height; ++y) {
+        for (uint16_t x = 0; ok && x < panel->base.panel_width; ++x) {
+            rgb_t   rgb      = qp_virtual_panel_get_pixel(device, x, y);
+            uint8_t pixel[3] = {rgb.r, rgb.g, rgb.b};
+            ok               = fwrite(pixel, sizeof(pixel), 1, f) == 1;
+        }
+    }
+    return fclose(f) == 0 && ok;
+}
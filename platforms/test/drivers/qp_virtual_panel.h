@@ -0,0 +1,80 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "color.h"
+#include "qp_internal.h"
+
+/*
+    Virtual Quantum Painter panel for the test platform.
+
+    Behaves like a MIPI DCS panel (ST7789, ILI9341 and friends): the driver
+    vtable is the generic TFT panel implementation, and the comms vtable
+    decodes the resulting command stream (CASET, RASET, RAMWR, MADCTL, ...)
+    into an in-memory GRAM, so drawing code runs exactly as it would against
+    real hardware. GRAM is stored in the panel's wire format -- big-endian
+    RGB565, or RGB888 -- in physical (unrotated) order.
+
+    Every byte that would cross the bus is counted, split into command and
+    data bytes, so that changes to the drawing routines can be benchmarked
+    by their transfer cost. Frames can be dumped to PPM for inspection, or
+    hashed for golden tests.
+*/
+
+#ifndef QP_VIRTUAL_PANEL_NUM_DEVICES
+#    define QP_VIRTUAL_PANEL_NUM_DEVICES 1
+#endif
+
+// Helper for determining the GRAM size required for a virtual panel
+#define QP_VIRTUAL_PANEL_BUFFER_SIZE(w, h, bpp) ((w) * (h) * ((bpp) / 8))
+
+typedef struct qp_virtual_panel_stats_t {
+    uint32_t transactions;   // comms start/stop pairs, i.e. chip select assertions
+    uint32_t commands;       // bytes sent with D/C low
+    uint32_t data_bytes;     // bytes sent with D/C high, including command parameters
+    uint32_t windows;        // memory writes started, i.e. viewports set
+    uint32_t pixels;         // pixels written to GRAM
+    uint32_t clipped_pixels; // pixels written outside of the panel, which should never happen
+} qp_virtual_panel_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Factory method for a virtual panel.
+ *
+ * @param panel_width[in] the width of the panel, in its native orientation
+ * @param panel_height[in] the height of the panel, in its native orientation
+ * @param bits_per_pixel[in] either 16 (RGB565) or 24 (RGB888)
+ * @param buffer[in] pointer to a preallocated buffer of size `QP_VIRTUAL_PANEL_BUFFER_SIZE(panel_width, panel_height, bits_per_pixel)`
+ * @return the device handle used with all drawing routines in Quantum Painter
+ */
+painter_device_t qp_virtual_panel_make_device(uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel, void *buffer);
+
+// Returns the device to the pool, so that each test can start from a fresh panel
+void qp_virtual_panel_release(painter_device_t device);
+
+// Bus statistics, accumulated since the device was created or last reset
+const qp_virtual_panel_stats_t *qp_virtual_panel_get_stats(painter_device_t device);
+void                            qp_virtual_panel_reset_stats(painter_device_t device);
+
+// Total bytes that crossed the bus
+uint32_t qp_virtual_panel_bus_bytes(painter_device_t device);
+
+// Reads back a pixel from GRAM, in physical (unrotated) coordinates
+rgb_t qp_virtual_panel_get_pixel(painter_device_t device, uint16_t x, uint16_t y);
+
+// FNV-1a hash of GRAM, for golden tests
+uint32_t qp_virtual_panel_hash(painter_device_t device);
+
+// Writes GRAM to a binary PPM file, in physical (unrotated) orientation
+bool qp_virtual_panel_write_ppm(painter_device_t device, const char *filename);
+
+#ifdef __cplusplus
+}
+#endif
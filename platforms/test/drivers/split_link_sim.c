@@ -0,0 +1,158 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "split_link_sim.h"
+#include "serial.h"
+#include "transactions.h"
+#include "transport.h"
+
+void advance_time(uint32_t ms);
+
+static split_link_sim_config_t sim_config;
+static split_link_sim_stats_t  sim_stats;
+static split_shared_memory_t   inactive_shmem;
+static bool                    slave_active;
+static bool                    disconnected;
+static uint32_t                rng_state;
+static uint32_t                pending_us;
+
+static uint32_t split_link_sim_rand(void) {
+    // xorshift32, deterministic for a given seed
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void split_link_sim_spend_us(uint32_t us) {
+    sim_stats.busy_us += us;
+    pending_us += us;
+    if (pending_us >= 1000) {
+        advance_time(pending_us / 1000);
+        pending_us %= 1000;
+    }
+}
+
+static void split_link_sim_swap_context(void) {
+    split_shared_memory_t temp;
+    memcpy(&temp, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &inactive_shmem, sizeof(split_shared_memory_t));
+    memcpy(&inactive_shmem, &temp, sizeof(split_shared_memory_t));
+    slave_active = !slave_active;
+}
+
+// Moves bytes across the wire, charging bandwidth and injecting bit errors
+static void split_link_sim_transfer(uint8_t *dest, const uint8_t *src, uint16_t length) {
+    for (uint16_t i = 0; i < length; ++i) {
+        uint8_t byte = src[i];
+        if (sim_config.bit_error_ppm) {
+            for (uint8_t bit = 0; bit < 8; ++bit) {
+                if ((split_link_sim_rand() % 1000000) < sim_config.bit_error_ppm) {
+                    byte ^= (1 << bit);
+                    sim_stats.bit_errors++;
+                }
+            }
+        }
+        dest[i] = byte;
+    }
+
+    sim_stats.bytes += length;
+    if (sim_config.bytes_per_sec) {
+        split_link_sim_spend_us((uint32_t)(((uint64_t)length * 1000000) / sim_config.bytes_per_sec));
+    }
+}
+
+void split_link_sim_init(const split_link_sim_config_t *config) {
+    memcpy(&sim_config, config, sizeof(split_link_sim_config_t));
+    memset(&sim_stats, 0, sizeof(split_link_sim_stats_t));
+    if (slave_active) {
+        split_link_sim_swap_context();
+    }
+    memset(split_shmem, 0, sizeof(split_shared_memory_t));
+    memset(&inactive_shmem, 0, sizeof(split_shared_memory_t));
+    rng_state    = config->seed ? config->seed : 0x2545F491;
+    pending_us   = 0;
+    disconnected = false;
+}
+
+const split_link_sim_stats_t *split_link_sim_get_stats(void) {
+    return &sim_stats;
+}
+
+bool split_link_sim_is_slave_active(void) {
+    return slave_active;
+}
+
+void split_link_sim_set_connected(bool connected) {
+    disconnected = !connected;
+}
+
+void split_link_sim_run_on_slave(void (*fn)(void *arg), void *arg) {
+    split_link_sim_swap_context();
+    fn(arg);
+    split_link_sim_swap_context();
+}
+
+void split_link_sim_slave_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_link_sim_swap_context();
+    transactions_slave(master_matrix, slave_matrix);
+    split_link_sim_swap_context();
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+bool soft_serial_transaction(int index) {
+    if (index < 0 || index >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+
+    split_transaction_desc_t *trans   = &split_transaction_table[index];
+    uint8_t                  *slave   = (uint8_t *)&inactive_shmem;
+    uint8_t                   sent    = (uint8_t)index;
+    uint8_t                   shake   = 0;
+    bool                      okay    = true;
+    uint8_t                   receive = 0;
+
+    sim_stats.transactions++;
+    split_link_sim_spend_us(sim_config.latency_us);
+
+    if (disconnected) {
+        sim_stats.failed_transactions++;
+        return false;
+    }
+
+    // Handshake, mirrors the serial protocol: the slave replies with the ID XORed with the transaction count
+    split_link_sim_transfer(&receive, &sent, sizeof(sent));
+    if (receive >= NUM_TOTAL_TRANSACTIONS) {
+        okay = false;
+    } else {
+        // A corrupted but valid ID makes the slave act on the wrong transaction
+        trans         = &split_transaction_table[receive];
+        uint8_t reply = receive ^ NUM_TOTAL_TRANSACTIONS;
+        split_link_sim_transfer(&shake, &reply, sizeof(reply));
+        okay = shake == (sent ^ NUM_TOTAL_TRANSACTIONS);
+    }
+
+    if (okay && trans->initiator2target_buffer_size) {
+        split_link_sim_transfer(slave + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    }
+
+    if (okay && trans->slave_callback) {
+        split_link_sim_swap_context();
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        split_link_sim_swap_context();
+    }
+
+    if (okay && trans->target2initiator_buffer_size) {
+        split_link_sim_transfer(split_trans_target2initiator_buffer(trans), slave + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+    }
+
+    if (!okay) {
+        sim_stats.failed_transactions++;
+    }
+    return okay;
+}
@@ -0,0 +1,62 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "matrix.h"
+
+/*
+    Simulated split serial link for the test platform.
+
+    Implements the `soft_serial_*` transport API so that the stock
+    `transport.c`/`transactions.c` can run both halves of a split keyboard
+    inside one process. The slave half owns a private copy of the split
+    shared memory, which is swapped in whenever slave-side code runs, so
+    each half only ever sees data that actually crossed the simulated link.
+
+    Time is advanced through the test platform timer according to the
+    configured latency and bandwidth, and bits are flipped on the wire
+    according to the configured bit error rate.
+*/
+
+typedef struct split_link_sim_config_t {
+    uint32_t latency_us;    // fixed cost of every transaction, in microseconds
+    uint32_t bytes_per_sec; // link bandwidth, 0 for unlimited
+    uint32_t bit_error_ppm; // probability of any single bit being flipped, in parts per million
+    uint32_t seed;          // seed for the bit error generator
+} split_link_sim_config_t;
+
+typedef struct split_link_sim_stats_t {
+    uint32_t transactions;
+    uint32_t failed_transactions;
+    uint32_t bytes;
+    uint32_t bit_errors;
+    uint64_t busy_us;
+} split_link_sim_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void split_link_sim_init(const split_link_sim_config_t *config);
+
+const split_link_sim_stats_t *split_link_sim_get_stats(void);
+
+// Runs the slave half's `transactions_slave()` against the slave's own view of the shared memory
+void split_link_sim_slave_task(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+// Runs `fn` against the slave's own view of the shared memory
+void split_link_sim_run_on_slave(void (*fn)(void *arg), void *arg);
+
+// True while slave-side code is running, used to answer `is_keyboard_master()`
+bool split_link_sim_is_slave_active(void);
+
+// Drops every transaction while disconnected, e.g. to model the slave rebooting
+void split_link_sim_set_connected(bool connected);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,166 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <vector>
+
+extern "C" {
+#include "eeprom_page_cache.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define MOCK_EEPROM_SIZE (EXTERNAL_EEPROM_PAGE_SIZE * 8)
+
+struct BackendWrite {
+    uint32_t addr;
+    size_t   len;
+};
+
+static std::array<uint8_t, MOCK_EEPROM_SIZE> backend_memory;
+static std::vector<BackendWrite>             backend_writes;
+static int                                   backend_reads;
+
+extern "C" void eeprom_page_cache_backend_read(uint32_t addr, void *buf, size_t len) {
+    backend_reads++;
+    memcpy(buf, &backend_memory[addr], len);
+}
+
+extern "C" void eeprom_page_cache_backend_write(uint32_t addr, const void *buf, size_t len) {
+    EXPECT_EQ(addr / EXTERNAL_EEPROM_PAGE_SIZE, (addr + len - 1) / EXTERNAL_EEPROM_PAGE_SIZE) << "Write crossed a page boundary";
+    backend_writes.push_back({addr, len});
+    memcpy(&backend_memory[addr], buf, len);
+}
+
+class EepromPageCache : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        for (size_t i = 0; i < backend_memory.size(); ++i) {
+            backend_memory[i] = (uint8_t)i;
+        }
+        backend_writes.clear();
+        backend_reads = 0;
+        eeprom_page_cache_init();
+    }
+
+    void write_byte(uint32_t addr, uint8_t value) {
+        eeprom_page_cache_write(addr, &value, 1);
+    }
+
+    uint8_t read_byte(uint32_t addr) {
+        uint8_t value = 0;
+        eeprom_page_cache_read(addr, &value, 1);
+        return value;
+    }
+};
+
+/**
+ * This test verifies that repeated writes within a page reach the device as a single write of only the changed span.
+ */
+TEST_F(EepromPageCache, RepeatedWrites_SinglePageProgram) {
+    for (uint8_t i = 0; i < 10; ++i) {
+        write_byte(5, 0xA0 + i);
+        write_byte(9, 0xB0 + i);
+    }
+    EXPECT_TRUE(backend_writes.empty()) << "Nothing should be written before a flush";
+    EXPECT_EQ(read_byte(9), 0xB9) << "Reads should observe pending writes";
+
+    eeprom_page_cache_flush();
+    ASSERT_EQ(backend_writes.size(), 1u) << "Changes within a page should be written together";
+    EXPECT_EQ(backend_writes[0].addr, 5u);
+    EXPECT_EQ(backend_writes[0].len, 5u);
+    EXPECT_EQ(backend_memory[5], 0xA9);
+    EXPECT_EQ(backend_memory[9], 0xB9);
+    EXPECT_EQ(backend_reads, 1) << "The page should have been read only once";
+    EXPECT_FALSE(eeprom_page_cache_is_dirty());
+}
+
+/**
+ * This test verifies that writing the value already stored does not dirty the page, so updates cost no bus writes.
+ */
+TEST_F(EepromPageCache, UnchangedWrite_NotDirty) {
+    write_byte(3, backend_memory[3]);
+    EXPECT_FALSE(eeprom_page_cache_is_dirty());
+    eeprom_page_cache_flush();
+    EXPECT_TRUE(backend_writes.empty());
+}
+
+/**
+ * This test verifies that repeated reads are served from the cache.
+ */
+TEST_F(EepromPageCache, Reads_ServedFromCache) {
+    uint8_t buf[EXTERNAL_EEPROM_PAGE_SIZE];
+    eeprom_page_cache_read(EXTERNAL_EEPROM_PAGE_SIZE - 2, buf, sizeof(buf));
+    EXPECT_EQ(backend_reads, 2) << "Range spans two pages";
+    eeprom_page_cache_read(EXTERNAL_EEPROM_PAGE_SIZE - 2, buf, sizeof(buf));
+    EXPECT_EQ(backend_reads, 2) << "Second read should have been served from cache";
+    for (size_t i = 0; i < sizeof(buf); ++i) {
+        EXPECT_EQ(buf[i], backend_memory[EXTERNAL_EEPROM_PAGE_SIZE - 2 + i]);
+    }
+}
+
+/**
+ * This test verifies that a full page write on a miss skips reading the old contents.
+ */
+TEST_F(EepromPageCache, FullPageWrite_NoFill) {
+    uint8_t page[EXTERNAL_EEPROM_PAGE_SIZE];
+    memset(page, 0x5A, sizeof(page));
+    eeprom_page_cache_write(EXTERNAL_EEPROM_PAGE_SIZE * 2, page, sizeof(page));
+    EXPECT_EQ(backend_reads, 0);
+
+    eeprom_page_cache_flush();
+    ASSERT_EQ(backend_writes.size(), 1u);
+    EXPECT_EQ(backend_writes[0].len, (size_t)EXTERNAL_EEPROM_PAGE_SIZE);
+    EXPECT_EQ(backend_memory[EXTERNAL_EEPROM_PAGE_SIZE * 2 + 7], 0x5A);
+}
+
+/**
+ * This test verifies that evicting a dirty page writes it back first.
+ */
+TEST_F(EepromPageCache, Eviction_WritesBack) {
+    write_byte(0, 0xEE);
+    for (uint32_t page = 1; page <= EXTERNAL_EEPROM_PAGE_CACHE_LINES; ++page) {
+        read_byte(page * EXTERNAL_EEPROM_PAGE_SIZE);
+    }
+    ASSERT_EQ(backend_writes.size(), 1u) << "Least recently used dirty page should have been written back";
+    EXPECT_EQ(backend_writes[0].addr, 0u);
+    EXPECT_EQ(backend_memory[0], 0xEE);
+
+    EXPECT_EQ(read_byte(0), 0xEE) << "Evicted page should be re-read with the new value";
+}
+
+/**
+ * This test verifies that the task only writes back once writes have been idle for long enough.
+ */
+TEST_F(EepromPageCache, Task_FlushesWhenIdle) {
+    write_byte(1, 0x11);
+    eeprom_page_cache_task();
+    EXPECT_TRUE(backend_writes.empty()) << "Writes are not idle yet";
+
+    advance_time(EXTERNAL_EEPROM_PAGE_CACHE_IDLE_MS / 2);
+    write_byte(2, 0x22);
+    advance_time(EXTERNAL_EEPROM_PAGE_CACHE_IDLE_MS / 2);
+    eeprom_page_cache_task();
+    EXPECT_TRUE(backend_writes.empty()) << "A later write should push the flush back";
+
+    advance_time(EXTERNAL_EEPROM_PAGE_CACHE_IDLE_MS);
+    eeprom_page_cache_task();
+    EXPECT_EQ(backend_writes.size(), 1u);
+    EXPECT_FALSE(eeprom_page_cache_is_dirty());
+}
+
+/**
+ * This test verifies that invalidating drops cached data, so subsequent reads go to the device.
+ */
+TEST_F(EepromPageCache, Invalidate_DiscardsPages) {
+    write_byte(4, 0x44);
+    eeprom_page_cache_invalidate();
+    EXPECT_FALSE(eeprom_page_cache_is_dirty());
+    EXPECT_EQ(read_byte(4), backend_memory[4]);
+    EXPECT_TRUE(backend_writes.empty());
+}
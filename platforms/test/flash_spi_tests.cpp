@@ -0,0 +1,232 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+extern "C" {
+#include "flash.h"
+#include "flash_spi.h"
+#include "flash_spi_sim.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+}
+
+// Roughly a 16MHz bus and the typical timings of an MX25L4006E
+static const flash_spi_sim_config_t default_config = {
+    .bytes_per_sec   = 2000000,
+    .page_program_us = 600,
+    .sector_erase_us = 40000,
+    .block_erase_us  = 500000,
+    .chip_erase_us   = 3000000,
+};
+
+struct CompletionRecord {
+    int            count  = 0;
+    flash_status_t status = FLASH_STATUS_ERROR;
+};
+
+static void record_completion(flash_status_t status, void *cb_arg) {
+    CompletionRecord *record = (CompletionRecord *)cb_arg;
+    record->count++;
+    record->status = status;
+}
+
+class FlashSpi : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        flash_spi_sim_init(&default_config);
+        flash_init();
+    }
+
+    std::vector<uint8_t> pattern(size_t len, uint8_t seed) {
+        std::vector<uint8_t> data(len);
+        for (size_t i = 0; i < len; ++i) {
+            data[i] = (uint8_t)(seed + i * 7);
+        }
+        return data;
+    }
+
+    bool sim_matches(uint32_t addr, const std::vector<uint8_t> &data) {
+        return memcmp(flash_spi_sim_memory() + addr, data.data(), data.size()) == 0;
+    }
+
+    // Runs the main loop until the queue drains, returning the longest time spent in a single flash_task() call
+    uint64_t run_until_idle(uint32_t scan_us, uint32_t *scans = nullptr) {
+        uint64_t longest = 0;
+        for (uint32_t i = 0;; ++i) {
+            EXPECT_LT(i, 1000000u) << "Queue never drained";
+            uint64_t       start  = flash_spi_sim_now_us();
+            flash_status_t status = flash_task();
+            longest               = std::max(longest, flash_spi_sim_now_us() - start);
+            if (status == FLASH_STATUS_SUCCESS || i >= 1000000u) {
+                break;
+            }
+            flash_spi_sim_spend_us(scan_us);
+            if (scans) {
+                (*scans)++;
+            }
+        }
+        return longest;
+    }
+};
+
+TEST_F(FlashSpi, SyncWriteReadBack) {
+    auto data = pattern(1000, 0x10);
+    EXPECT_EQ(flash_write_range(100, data.data(), data.size()), FLASH_STATUS_SUCCESS);
+    EXPECT_TRUE(sim_matches(100, data));
+
+    std::vector<uint8_t> readback(data.size());
+    EXPECT_EQ(flash_read_range(100, readback.data(), readback.size()), FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(readback, data);
+    // Start and end of the range fall part way through a page
+    EXPECT_EQ(flash_spi_sim_get_stats()->page_programs, 5u);
+    EXPECT_EQ(flash_spi_sim_get_stats()->busy_violations, 0u);
+}
+
+TEST_F(FlashSpi, AsyncWriteCompletes) {
+    auto             data = pattern(1000, 0x20);
+    CompletionRecord record;
+    EXPECT_EQ(flash_write_range_async(100, data.data(), data.size(), record_completion, &record), FLASH_STATUS_SUCCESS);
+    EXPECT_FALSE(flash_is_idle());
+    EXPECT_EQ(flash_spi_sim_get_stats()->page_programs, 0u) << "Nothing should happen until flash_task() runs";
+
+    run_until_idle(100);
+    EXPECT_TRUE(flash_is_idle());
+    EXPECT_EQ(record.count, 1);
+    EXPECT_EQ(record.status, FLASH_STATUS_SUCCESS);
+    EXPECT_TRUE(sim_matches(100, data));
+    EXPECT_EQ(flash_spi_sim_get_stats()->page_programs, 5u);
+    EXPECT_EQ(flash_spi_sim_get_stats()->busy_violations, 0u);
+}
+
+TEST_F(FlashSpi, AsyncEraseDoesNotBlock) {
+    auto data = pattern(64, 0x30);
+    EXPECT_EQ(flash_write_range(EXTERNAL_FLASH_BLOCK_SIZE, data.data(), data.size()), FLASH_STATUS_SUCCESS);
+
+    CompletionRecord record;
+    uint32_t         scans = 0;
+    EXPECT_EQ(flash_erase_block_async(EXTERNAL_FLASH_BLOCK_SIZE, record_completion, &record), FLASH_STATUS_SUCCESS);
+    uint64_t longest = run_until_idle(1000, &scans);
+
+    EXPECT_EQ(record.count, 1);
+    EXPECT_EQ(record.status, FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(flash_spi_sim_memory()[EXTERNAL_FLASH_BLOCK_SIZE], 0xFF);
+    // The main loop kept scanning for the whole erase, and was never held up for more than a few bus transfers
+    EXPECT_GE(scans, default_config.block_erase_us / 1000);
+    EXPECT_LT(longest, 100u);
+    EXPECT_EQ(flash_spi_sim_get_stats()->busy_violations, 0u);
+}
+
+TEST_F(FlashSpi, SyncEraseBlocks) {
+    uint64_t start = flash_spi_sim_now_us();
+    EXPECT_EQ(flash_erase_block(EXTERNAL_FLASH_BLOCK_SIZE), FLASH_STATUS_SUCCESS);
+    EXPECT_GE(flash_spi_sim_now_us() - start, default_config.block_erase_us);
+}
+
+TEST_F(FlashSpi, SyncCallDrainsQueue) {
+    auto             data = pattern(300, 0x40);
+    CompletionRecord record;
+    EXPECT_EQ(flash_write_range_async(0, data.data(), data.size(), record_completion, &record), FLASH_STATUS_SUCCESS);
+
+    std::vector<uint8_t> readback(data.size());
+    EXPECT_EQ(flash_read_range(0, readback.data(), readback.size()), FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(readback, data);
+    EXPECT_EQ(record.count, 1);
+    EXPECT_TRUE(flash_is_idle());
+}
+
+struct EraseThenWrite {
+    std::vector<uint8_t> data;
+    CompletionRecord     write;
+};
+
+static void write_after_erase(flash_status_t status, void *cb_arg) {
+    EraseThenWrite *ctx = (EraseThenWrite *)cb_arg;
+    EXPECT_EQ(status, FLASH_STATUS_SUCCESS);
+    EXPECT_EQ(flash_write_range_async(EXTERNAL_FLASH_SECTOR_SIZE, ctx->data.data(), ctx->data.size(), record_completion, &ctx->write), FLASH_STATUS_SUCCESS);
+}
+
+TEST_F(FlashSpi, CallbackQueuesFollowUp) {
+    auto old = pattern(32, 0x50);
+    EXPECT_EQ(flash_write_range(EXTERNAL_FLASH_SECTOR_SIZE, old.data(), old.size()), FLASH_STATUS_SUCCESS);
+
+    EraseThenWrite ctx;
+    ctx.data = pattern(32, 0x60);
+    EXPECT_EQ(flash_erase_sector_async(EXTERNAL_FLASH_SECTOR_SIZE, write_after_erase, &ctx), FLASH_STATUS_SUCCESS);
+    run_until_idle(500);
+
+    EXPECT_EQ(ctx.write.count, 1);
+    EXPECT_EQ(ctx.write.status, FLASH_STATUS_SUCCESS);
+    EXPECT_TRUE(sim_matches(EXTERNAL_FLASH_SECTOR_SIZE, ctx.data));
+}
+
+TEST_F(FlashSpi, QueueLimitsAndBounds) {
+    uint8_t byte = 0;
+    for (int i = 0; i < EXTERNAL_FLASH_ASYNC_QUEUE_SIZE; ++i) {
+        EXPECT_EQ(flash_write_range_async(i, &byte, 1, NULL, NULL), FLASH_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(flash_write_range_async(0, &byte, 1, NULL, NULL), FLASH_STATUS_BUSY);
+    run_until_idle(0);
+
+    EXPECT_EQ(flash_write_range_async(EXTERNAL_FLASH_SIZE - 1, &byte, 2, NULL, NULL), FLASH_STATUS_BAD_ADDRESS);
+    EXPECT_EQ(flash_erase_sector_async(1, NULL, NULL), FLASH_STATUS_BAD_ADDRESS);
+    EXPECT_EQ(flash_erase_block_async(EXTERNAL_FLASH_SIZE, NULL, NULL), FLASH_STATUS_BAD_ADDRESS);
+    EXPECT_EQ(flash_erase_sector_async(EXTERNAL_FLASH_SIZE - EXTERNAL_FLASH_SECTOR_SIZE, NULL, NULL), FLASH_STATUS_SUCCESS) << "Last sector should be erasable";
+    run_until_idle(0);
+
+    // The synchronous calls accept the same addresses
+    EXPECT_EQ(flash_erase_sector(1), FLASH_STATUS_ERROR);
+    EXPECT_EQ(flash_erase_block(EXTERNAL_FLASH_SIZE), FLASH_STATUS_ERROR);
+    EXPECT_EQ(flash_erase_sector(EXTERNAL_FLASH_SIZE - EXTERNAL_FLASH_SECTOR_SIZE), FLASH_STATUS_SUCCESS) << "Last sector should be erasable";
+    EXPECT_EQ(flash_erase_block(EXTERNAL_FLASH_SIZE - EXTERNAL_FLASH_BLOCK_SIZE), FLASH_STATUS_SUCCESS) << "Last block should be erasable";
+}
+
+TEST_F(FlashSpi, StuckChipTimesOut) {
+    flash_spi_sim_config_t config = default_config;
+    config.sector_erase_us        = (EXTERNAL_FLASH_SPI_TIMEOUT + 500) * 1000;
+    flash_spi_sim_init(&config);
+
+    CompletionRecord record;
+    EXPECT_EQ(flash_erase_sector_async(0, record_completion, &record), FLASH_STATUS_SUCCESS);
+    run_until_idle(1000);
+    EXPECT_EQ(record.count, 1);
+    EXPECT_EQ(record.status, FLASH_STATUS_TIMEOUT);
+}
+
+/**
+ * Writes 64kB while a 250us main loop keeps running. The async path should sustain close to the synchronous
+ * throughput, since the loop runs while the chip programs each page, instead of stalling for the whole write.
+ */
+TEST_F(FlashSpi, ThroughputBenchmark) {
+    auto data = pattern(EXTERNAL_FLASH_BLOCK_SIZE, 0x70);
+
+    uint64_t start = flash_spi_sim_now_us();
+    EXPECT_EQ(flash_write_range(0, data.data(), data.size()), FLASH_STATUS_SUCCESS);
+    uint64_t sync_us = flash_spi_sim_now_us() - start;
+
+    flash_spi_sim_init(&default_config);
+    CompletionRecord record;
+    uint32_t         scans = 0;
+    start                  = flash_spi_sim_now_us();
+    EXPECT_EQ(flash_write_range_async(0, data.data(), data.size(), record_completion, &record), FLASH_STATUS_SUCCESS);
+    uint64_t longest  = run_until_idle(250, &scans);
+    uint64_t async_us = flash_spi_sim_now_us() - start;
+
+    EXPECT_EQ(record.status, FLASH_STATUS_SUCCESS);
+    EXPECT_TRUE(sim_matches(0, data));
+    EXPECT_EQ(flash_spi_sim_get_stats()->busy_violations, 0u);
+
+    RecordProperty("sync_kBps", (int)((uint64_t)data.size() * 1000 / sync_us));
+    RecordProperty("async_kBps", (int)((uint64_t)data.size() * 1000 / async_us));
+    RecordProperty("async_scans", (int)scans);
+
+    // Longest stall is a single page transfer, rather than the full 64kB
+    EXPECT_LT(longest, 2 * (EXTERNAL_FLASH_PAGE_SIZE + 8) * 1000000ull / default_config.bytes_per_sec);
+    EXPECT_GT(sync_us, longest * 100);
+    EXPECT_GE(scans, data.size() / EXTERNAL_FLASH_PAGE_SIZE);
+    EXPECT_LT(async_us, sync_us * 3 / 2);
+}
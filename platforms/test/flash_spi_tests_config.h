@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+
+// The test platform has no GPIO, the simulated flash ignores chip select
+typedef uint8_t pin_t;
+
+#define EXTERNAL_FLASH_SPI_SLAVE_SELECT_PIN 0
+#define EXTERNAL_FLASH_SPI_TIMEOUT 1000
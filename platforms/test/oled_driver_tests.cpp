@@ -0,0 +1,159 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+extern "C" {
+#include "i2c_master.h"
+#include "oled_driver.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+// Display RAM of the SSD1306, as written through the stubbed I2C transport. Unrotated, it has the same layout as the
+// driver's buffer.
+static uint8_t  gram[OLED_MATRIX_SIZE];
+static uint8_t  column, page, column_start, column_end, page_start, page_end;
+static uint32_t data_bytes;
+
+static bool     master;
+static uint32_t task_user_calls;
+
+extern "C" {
+bool is_keyboard_master(void) {
+    return master;
+}
+
+bool oled_task_user(void) {
+    task_user_calls++;
+    return false;
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    // Only the addressing command matters, everything else is display setup
+    if (length == 7 && data[1] == 0x21) {
+        column = column_start = data[2];
+        column_end            = data[3];
+        page = page_start = data[5];
+        page_end          = data[6];
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t *data, uint16_t length, uint16_t timeout) {
+    for (uint16_t i = 0; i < length; ++i) {
+        gram[page * OLED_DISPLAY_WIDTH + column] = data[i];
+        if (++column > column_end) {
+            column = column_start;
+            if (++page > page_end) {
+                page = page_start;
+            }
+        }
+    }
+    data_bytes += length;
+    return I2C_STATUS_SUCCESS;
+}
+}
+
+class OledDriver : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+        master          = true;
+        task_user_calls = 0;
+        memset(gram, 0, sizeof(gram));
+        ASSERT_TRUE(oled_init(OLED_ROTATION_0));
+        oled_render_dirty(true);
+
+        // Start with nothing left to mirror
+        uint8_t block, data[OLED_BLOCK_SIZE];
+        while (oled_mirror_get_block(&block, data)) {
+        }
+        data_bytes = 0;
+    }
+
+    bool gram_matches_buffer(void) {
+        oled_buffer_reader_t reader = oled_read_raw(0);
+        return reader.remaining_element_count == OLED_MATRIX_SIZE && memcmp(gram, reader.current_element, OLED_MATRIX_SIZE) == 0;
+    }
+};
+
+TEST_F(OledDriver, MirrorGetBlock_ReturnsChangedBlocksInOrder) {
+    oled_write_raw_byte(0x55, OLED_MATRIX_SIZE - 1);
+    oled_write_raw_byte(0xAA, 3);
+
+    uint8_t block, data[OLED_BLOCK_SIZE];
+    ASSERT_TRUE(oled_mirror_get_block(&block, data));
+    EXPECT_EQ(block, 0);
+    EXPECT_EQ(data[3], 0xAA);
+    ASSERT_TRUE(oled_mirror_get_block(&block, data));
+    EXPECT_EQ(block, OLED_BLOCK_COUNT - 1);
+    EXPECT_EQ(data[OLED_BLOCK_SIZE - 1], 0x55);
+    EXPECT_FALSE(oled_mirror_get_block(&block, data)) << "Blocks are only handed out once per change";
+}
+
+TEST_F(OledDriver, MirrorAll_ReturnsEveryBlock) {
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; ++i) {
+        oled_write_raw_byte(i * 7, i);
+    }
+    uint8_t block, data[OLED_BLOCK_SIZE];
+    while (oled_mirror_get_block(&block, data)) {
+    }
+
+    oled_mirror_all();
+    oled_buffer_reader_t reader = oled_read_raw(0);
+    for (uint8_t i = 0; i < OLED_BLOCK_COUNT; ++i) {
+        ASSERT_TRUE(oled_mirror_get_block(&block, data));
+        EXPECT_EQ(block, i);
+        EXPECT_EQ(memcmp(data, &reader.current_element[OLED_BLOCK_SIZE * i], OLED_BLOCK_SIZE), 0) << "block " << (int)i;
+    }
+    EXPECT_FALSE(oled_mirror_get_block(&block, data));
+}
+
+TEST_F(OledDriver, MirrorSetBlock_OnlyRendersChangedBytes) {
+    master = false;
+
+    uint8_t data[OLED_BLOCK_SIZE] = {0};
+    data[5]                       = 0x12;
+    data[9]                       = 0x34;
+    oled_mirror_set_block(2, data);
+    oled_render_dirty(true);
+    EXPECT_TRUE(gram_matches_buffer());
+    EXPECT_EQ(gram[OLED_BLOCK_SIZE * 2 + 5], 0x12);
+    EXPECT_EQ(gram[OLED_BLOCK_SIZE * 2 + 9], 0x34);
+    EXPECT_EQ(data_bytes, 5u) << "Only the span of changed bytes is sent to the display";
+
+    // The same block again changes nothing, and neither does a block outside the buffer
+    data_bytes = 0;
+    oled_mirror_set_block(2, data);
+    oled_mirror_set_block(OLED_BLOCK_COUNT, data);
+    oled_render_dirty(true);
+    EXPECT_EQ(data_bytes, 0u);
+    EXPECT_TRUE(gram_matches_buffer());
+}
+
+TEST_F(OledDriver, Task_OnlyMasterDraws) {
+    master = false;
+    advance_time(OLED_UPDATE_INTERVAL);
+    oled_task();
+    EXPECT_EQ(task_user_calls, 0u) << "The slave shows what the master drew";
+
+    // The slave still renders whatever is mirrored to it
+    uint8_t data[OLED_BLOCK_SIZE];
+    memset(data, 0xFF, sizeof(data));
+    oled_mirror_set_block(1, data);
+    oled_task();
+    EXPECT_EQ(data_bytes, (uint32_t)OLED_BLOCK_SIZE);
+    EXPECT_TRUE(gram_matches_buffer());
+
+    master = true;
+    advance_time(OLED_UPDATE_INTERVAL);
+    oled_task();
+    EXPECT_EQ(task_user_calls, 1u);
+}
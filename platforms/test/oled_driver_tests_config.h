@@ -0,0 +1,8 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+// One half of a split keyboard with a 128x32 SSD1306, mirroring the master's buffer
+#define OLED_DISPLAY_128X32
+#define OLED_TIMEOUT 0
+#define OLED_UPDATE_INTERVAL 50
@@ -23,3 +23,41 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+flash_spi_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/flash_spi_tests_config.h
+flash_spi_INC := \
+	$(TOP_DIR)/drivers/flash \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers
+flash_spi_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(TOP_DIR)/drivers/flash/flash_spi.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/flash_spi_sim.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/flash_spi_tests.cpp
+
+eeprom_page_cache_DEFS := \
+	-DEEPROM_TEST_HARNESS \
+	-DEXTERNAL_EEPROM_PAGE_CACHE \
+	-DEXTERNAL_EEPROM_PAGE_SIZE=32 \
+	-DEXTERNAL_EEPROM_PAGE_CACHE_LINES=2
+eeprom_page_cache_INC := $(TOP_DIR)/drivers/eeprom
+eeprom_page_cache_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_page_cache.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_page_cache_tests.cpp
+
+oled_driver_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/oled_driver_tests_config.h
+oled_driver_DEFS := \
+	-DSPLIT_KEYBOARD \
+	-DOLED_ENABLE \
+	-DOLED_TRANSPORT_I2C \
+	-DSPLIT_OLED_MIRROR_ENABLE \
+	-DNO_PRINT \
+	-DNO_DEBUG
+oled_driver_INC := $(TOP_DIR)/drivers/oled
+oled_driver_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(TOP_DIR)/drivers/oled/oled_driver.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/oled_driver_tests.cpp
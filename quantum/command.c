@@ -50,6 +50,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "audio.h"
 #endif /* AUDIO_ENABLE */
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_LINK_STATS_ENABLE)
+#    include "split_link_stats.h"
+#endif
+
 static bool command_common(uint8_t code);
 static void command_common_help(void);
 static void print_version(void);
@@ -160,6 +164,10 @@ static void command_common_help(void) {
 #ifdef SLEEP_LED_ENABLE
         STR(MAGIC_KEY_SLEEP_LED) ":	Sleep LED Test\n"
 #endif
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_LINK_STATS_ENABLE)
+        STR(MAGIC_KEY_SPLIT_LINK_STATS) ":	Print Split Link Stats\n"
+#endif
     ); /* clang-format on */
 }
 
@@ -333,6 +341,13 @@ static bool command_common(uint8_t code) {
             break;
 #endif
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_LINK_STATS_ENABLE)
+        // print split link quality counters
+        case MAGIC_KC(MAGIC_KEY_SPLIT_LINK_STATS):
+            split_link_stats_print();
+            break;
+#endif
+
         // print stored eeprom config
         case MAGIC_KC(MAGIC_KEY_EEPROM):
 #if !defined(NO_PRINT) && !defined(USER_PRINT)
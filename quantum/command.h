@@ -158,5 +158,9 @@ bool command_proc(uint8_t code);
 
 #endif
 
+#ifndef MAGIC_KEY_SPLIT_LINK_STATS
+#    define MAGIC_KEY_SPLIT_LINK_STATS L
+#endif
+
 #define XMAGIC_KC(key) KC_##key
 #define MAGIC_KC(key) XMAGIC_KC(key)
@@ -32,28 +32,89 @@
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// RAM copy of the dynamic keymap, so that keycode lookups on the keypress path never touch NVM
+static uint16_t dynamic_keymap_cache[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+#    ifdef ENCODER_MAP_ENABLE
+static uint16_t dynamic_encodermap_cache[DYNAMIC_KEYMAP_LAYER_COUNT][NUM_ENCODERS][2];
+#    endif // ENCODER_MAP_ENABLE
+static bool dynamic_keymap_cache_loaded = false;
+
+static void dynamic_keymap_cache_load(void) {
+    // Single bulk read, then convert from the big-endian NVM layout in place
+    uint8_t *raw = (uint8_t *)dynamic_keymap_cache;
+    nvm_dynamic_keymap_read_buffer(0, sizeof(dynamic_keymap_cache), raw);
+    for (uint32_t i = 0; i < sizeof(dynamic_keymap_cache); i += 2) {
+        ((uint16_t *)raw)[i / 2] = (raw[i] << 8) | raw[i + 1];
+    }
+#    ifdef ENCODER_MAP_ENABLE
+    for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (int encoder = 0; encoder < NUM_ENCODERS; encoder++) {
+            dynamic_encodermap_cache[layer][encoder][0] = nvm_dynamic_keymap_read_encoder(layer, encoder, true);
+            dynamic_encodermap_cache[layer][encoder][1] = nvm_dynamic_keymap_read_encoder(layer, encoder, false);
+        }
+    }
+#    endif // ENCODER_MAP_ENABLE
+    dynamic_keymap_cache_loaded = true;
+}
+
+static inline void dynamic_keymap_cache_ensure_loaded(void) {
+    if (!dynamic_keymap_cache_loaded) {
+        dynamic_keymap_cache_load();
+    }
+}
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+    dynamic_keymap_cache_ensure_loaded();
+    return dynamic_keymap_cache[layer][row][column];
+#else  // DYNAMIC_KEYMAP_RAM_CACHE
     return nvm_dynamic_keymap_read_keycode(layer, row, column);
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (dynamic_keymap_cache_loaded && layer < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
+        dynamic_keymap_cache[layer][row][column] = keycode;
+    }
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
 }
 
 #ifdef ENCODER_MAP_ENABLE
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+    dynamic_keymap_cache_ensure_loaded();
+    return dynamic_encodermap_cache[layer][encoder_id][clockwise ? 0 : 1];
+#    else  // DYNAMIC_KEYMAP_RAM_CACHE
     return nvm_dynamic_keymap_read_encoder(layer, encoder_id, clockwise);
+#    endif // DYNAMIC_KEYMAP_RAM_CACHE
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     nvm_dynamic_keymap_update_encoder(layer, encoder_id, clockwise, keycode);
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (dynamic_keymap_cache_loaded && layer < DYNAMIC_KEYMAP_LAYER_COUNT && encoder_id < NUM_ENCODERS) {
+        dynamic_encodermap_cache[layer][encoder_id][clockwise ? 0 : 1] = keycode;
+    }
+#    endif // DYNAMIC_KEYMAP_RAM_CACHE
 }
 #endif // ENCODER_MAP_ENABLE
 
+void dynamic_keymap_init(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache_load();
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+}
+
 void dynamic_keymap_reset(void) {
     // Erase the keymaps, if necessary.
     nvm_dynamic_keymap_erase();
@@ -80,6 +141,20 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    if (dynamic_keymap_cache_loaded) {
+        // Same big-endian layout as NVM: even offsets are the high byte of a keycode
+        uint16_t *cache = (uint16_t *)dynamic_keymap_cache;
+        for (uint32_t i = 0; i < size && offset + i < sizeof(dynamic_keymap_cache); i++) {
+            uint32_t index = (offset + i) / 2;
+            if ((offset + i) & 1) {
+                cache[index] = (cache[index] & 0xFF00) | data[i];
+            } else {
+                cache[index] = (cache[index] & 0x00FF) | (data[i] << 8);
+            }
+        }
+    }
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -114,6 +189,10 @@ void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *da
     nvm_dynamic_keymap_macro_update_buffer(offset, size, data);
 }
 
+#ifndef DYNAMIC_KEYMAP_MACRO_READ_CHUNK_SIZE
+#    define DYNAMIC_KEYMAP_MACRO_READ_CHUNK_SIZE 16
+#endif
+
 static uint8_t dynamic_keymap_read_byte(uint32_t offset) {
     uint8_t d;
     nvm_dynamic_keymap_macro_read_buffer(offset, 1, &d);
@@ -122,13 +201,23 @@ static uint8_t dynamic_keymap_read_byte(uint32_t offset) {
 
 typedef struct send_string_nvm_state_t {
     uint32_t offset;
+    uint32_t chunk_offset; // offset of chunk[0] within the macro buffer
+    uint8_t  chunk_length; // zero until the first read
+    uint8_t  chunk[DYNAMIC_KEYMAP_MACRO_READ_CHUNK_SIZE];
 } send_string_nvm_state_t;
 
+// Reads the next byte of the macro buffer, refilling from NVM a chunk at a time rather than a byte at a time
+static uint8_t dynamic_keymap_read_next_byte(send_string_nvm_state_t *state) {
+    if (state->chunk_length == 0 || state->offset < state->chunk_offset || state->offset >= state->chunk_offset + state->chunk_length) {
+        state->chunk_offset = state->offset;
+        state->chunk_length = sizeof(state->chunk);
+        nvm_dynamic_keymap_macro_read_buffer(state->chunk_offset, state->chunk_length, state->chunk);
+    }
+    return state->chunk[state->offset++ - state->chunk_offset];
+}
+
 char send_string_get_next_nvm(void *arg) {
-    send_string_nvm_state_t *state = (send_string_nvm_state_t *)arg;
-    char                     ret   = dynamic_keymap_read_byte(state->offset);
-    state->offset++;
-    return ret;
+    return (char)dynamic_keymap_read_next_byte((send_string_nvm_state_t *)arg);
 }
 
 void dynamic_keymap_macro_reset(void) {
@@ -152,20 +241,18 @@ void dynamic_keymap_macro_send(uint8_t id) {
 
     // Skip N null characters
     // p will then point to the Nth macro
-    uint32_t offset = 0;
-    uint32_t end    = nvm_dynamic_keymap_macro_size();
+    send_string_nvm_state_t state = {.offset = 0};
+    uint32_t                end   = nvm_dynamic_keymap_macro_size();
     while (id > 0) {
         // If we are past the end of the buffer, then there is
         // no Nth macro in the buffer.
-        if (offset == end) {
+        if (state.offset == end) {
             return;
         }
-        if (dynamic_keymap_read_byte(offset) == 0) {
+        if (dynamic_keymap_read_next_byte(&state) == 0) {
             --id;
         }
-        ++offset;
     }
 
-    send_string_nvm_state_t state = {.offset = offset};
     send_string_with_delay_impl(send_string_get_next_nvm, &state, DYNAMIC_KEYMAP_MACRO_DELAY);
 }
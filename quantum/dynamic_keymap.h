@@ -26,6 +26,9 @@
 #    define DYNAMIC_KEYMAP_MACRO_COUNT 16
 #endif
 
+// Loads the RAM copy of the keymap when DYNAMIC_KEYMAP_RAM_CACHE is enabled, otherwise does nothing
+void dynamic_keymap_init(void);
+
 uint8_t  dynamic_keymap_get_layer_count(void);
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
 void     dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode);
@@ -167,6 +167,9 @@ void eeconfig_init_quantum(void) {
     extern void eeconfig_force_flush_led_matrix(void);
     eeconfig_force_flush_led_matrix();
 #endif // LED_MATRIX_ENABLE
+
+    // Everything above lands in a single write
+    eeconfig_flush();
 }
 
 void eeconfig_init(void) {
@@ -181,6 +184,18 @@ void eeconfig_disable(void) {
     nvm_eeconfig_disable();
 }
 
+void eeconfig_task(void) {
+#ifdef EECONFIG_RAM_CACHE
+    nvm_eeconfig_task();
+#endif // EECONFIG_RAM_CACHE
+}
+
+void eeconfig_flush(void) {
+#ifdef EECONFIG_RAM_CACHE
+    nvm_eeconfig_flush();
+#endif // EECONFIG_RAM_CACHE
+}
+
 bool eeconfig_is_enabled(void) {
     bool is_eeprom_enabled = nvm_eeconfig_is_enabled();
 #ifdef VIA_ENABLE
@@ -106,12 +106,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
+#ifdef FLASH_DRIVER_SPI
+#    include "flash.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -470,6 +476,10 @@ void keyboard_init(void) {
 #endif
     matrix_init();
     quantum_init();
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    // After quantum_init(), as EEPROM may have just been reset
+    dynamic_keymap_init();
+#endif
 #ifdef CONNECTION_ENABLE
     connection_init();
 #endif
@@ -802,4 +812,16 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef EECONFIG_RAM_CACHE
+    eeconfig_task();
+#endif
+
+#ifdef EEPROM_DRIVER
+    eeprom_driver_task();
+#endif
+
+#ifdef FLASH_DRIVER_SPI
+    flash_task();
+#endif
 }
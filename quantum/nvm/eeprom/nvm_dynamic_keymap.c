@@ -1,6 +1,7 @@
 // Copyright 2024 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "compiler_support.h"
 #include "keycodes.h"
 #include "eeprom.h"
@@ -68,8 +69,69 @@ STATIC_ASSERT((int64_t)(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (int64_t)(DYNAMIC_KEYM
 #    define DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE (DYNAMIC_KEYMAP_EEPROM_MAX_ADDR - DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + 1)
 #endif
 
+// Granularity of block updates -- matches the page size of external EEPROMs, so unchanged pages are never rewritten
+#ifndef DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE
+#    ifdef EXTERNAL_EEPROM_PAGE_SIZE
+#        define DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE (EXTERNAL_EEPROM_PAGE_SIZE)
+#    else
+#        define DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE 32
+#    endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Reads the part of [offset, offset+size) inside a region of region_size bytes starting at base, zero-filling the rest
+static void dynamic_keymap_read_region(uintptr_t base, uint32_t region_size, uint32_t offset, uint32_t size, uint8_t *data) {
+    uint32_t valid = offset < region_size ? region_size - offset : 0;
+    if (valid > size) {
+        valid = size;
+    }
+    if (valid > 0) {
+        eeprom_read_block(data, (const void *)(base + offset), valid);
+    }
+    memset(data + valid, 0, size - valid);
+}
+
+// Writes the part of [offset, offset+size) inside a region of region_size bytes starting at base, one chunk at a time,
+// only writing the runs of bytes which actually changed
+static void dynamic_keymap_update_region(uintptr_t base, uint32_t region_size, uint32_t offset, uint32_t size, const uint8_t *data) {
+    if (offset >= region_size) {
+        return;
+    }
+    if (size > region_size - offset) {
+        size = region_size - offset;
+    }
+
+    uint8_t current[DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE];
+    while (size > 0) {
+        uintptr_t address = base + offset;
+        uint32_t  length  = DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE - (address % DYNAMIC_KEYMAP_EEPROM_CHUNK_SIZE);
+        if (length > size) {
+            length = size;
+        }
+
+        eeprom_read_block(current, (const void *)address, length);
+        uint32_t first = 0;
+        while (first < length) {
+            // Skip over unchanged bytes, then write the run of changed ones that follows
+            if (current[first] == data[first]) {
+                first++;
+                continue;
+            }
+            uint32_t last = first + 1;
+            while (last < length && current[last] != data[last]) {
+                last++;
+            }
+            eeprom_write_block(data + first, (void *)(address + first), last - first);
+            first = last;
+        }
+
+        offset += length;
+        data += length;
+        size -= length;
+    }
+}
+
 void nvm_dynamic_keymap_erase(void) {
     // No-op, nvm_eeconfig_erase() will have already erased EEPROM if necessary.
 }
@@ -86,17 +148,17 @@ uint16_t nvm_dynamic_keymap_read_keycode(uint8_t layer, uint8_t row, uint8_t col
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = eeprom_read_byte(address) << 8;
-    keycode |= eeprom_read_byte(address + 1);
-    return keycode;
+    uint8_t raw[2];
+    eeprom_read_block(raw, address, sizeof(raw));
+    return (raw[0] << 8) | raw[1];
 }
 
 void nvm_dynamic_keymap_update_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    uint8_t raw[2] = {(uint8_t)(keycode >> 8), (uint8_t)(keycode & 0xFF)};
+    dynamic_keymap_update_region((uintptr_t)address, sizeof(raw), 0, sizeof(raw), raw);
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -108,46 +170,28 @@ uint16_t nvm_dynamic_keymap_read_encoder(uint8_t layer, uint8_t encoder_id, bool
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
-    keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
-    return keycode;
+    uint8_t raw[2];
+    eeprom_read_block(raw, address + (clockwise ? 0 : 2), sizeof(raw));
+    return (raw[0] << 8) | raw[1];
 }
 
 void nvm_dynamic_keymap_update_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+    uint8_t raw[2] = {(uint8_t)(keycode >> 8), (uint8_t)(keycode & 0xFF)};
+    dynamic_keymap_update_region((uintptr_t)(address + (clockwise ? 0 : 2)), sizeof(raw), 0, sizeof(raw), raw);
 }
 #endif // ENCODER_MAP_ENABLE
 
 void nvm_dynamic_keymap_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
     uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void    *source                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
-    for (uint32_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
-    }
+    dynamic_keymap_read_region(DYNAMIC_KEYMAP_EEPROM_ADDR, dynamic_keymap_eeprom_size, offset, size, data);
 }
 
 void nvm_dynamic_keymap_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
     uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void    *target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
-    for (uint32_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
-    }
+    dynamic_keymap_update_region(DYNAMIC_KEYMAP_EEPROM_ADDR, dynamic_keymap_eeprom_size, offset, size, data);
 }
 
 uint32_t nvm_dynamic_keymap_macro_size(void) {
@@ -155,29 +199,11 @@ uint32_t nvm_dynamic_keymap_macro_size(void) {
 }
 
 void nvm_dynamic_keymap_macro_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    void    *source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
-    }
+    dynamic_keymap_read_region(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE, offset, size, data);
 }
 
 void nvm_dynamic_keymap_macro_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    void    *target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *source = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
-    }
+    dynamic_keymap_update_region(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE, offset, size, data);
 }
 
 void nvm_dynamic_keymap_macro_reset(void) {
@@ -19,6 +19,11 @@ bool nvm_eeconfig_is_disabled(void);
 void nvm_eeconfig_enable(void);
 void nvm_eeconfig_disable(void);
 
+#ifdef EECONFIG_RAM_CACHE
+void nvm_eeconfig_task(void);
+void nvm_eeconfig_flush(void);
+#endif // EECONFIG_RAM_CACHE
+
 typedef union debug_config_t debug_config_t;
 void                         nvm_eeconfig_read_debug(debug_config_t *debug_config);
 void                         nvm_eeconfig_update_debug(const debug_config_t *debug_config);
@@ -0,0 +1,229 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <vector>
+
+extern "C" {
+#include "debug.h"
+#include "eeconfig.h"
+#include "eeprom.h"
+#include "keycode_config.h"
+#include "nvm_eeconfig.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
+layer_state_t default_layer_state = 0;
+}
+
+struct eeprom_access_t {
+    uintptr_t addr;
+    size_t    len;
+};
+
+static uint8_t                      fake_eeprom[256];
+static std::vector<eeprom_access_t> eeprom_reads;
+static std::vector<eeprom_access_t> eeprom_writes;
+
+extern "C" {
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_reads.push_back({(uintptr_t)addr, len});
+    memcpy(buf, &fake_eeprom[(uintptr_t)addr], len);
+}
+uint8_t eeprom_read_byte(const uint8_t *addr) {
+    uint8_t val;
+    eeprom_read_block(&val, addr, sizeof(val));
+    return val;
+}
+uint16_t eeprom_read_word(const uint16_t *addr) {
+    uint16_t val;
+    eeprom_read_block(&val, addr, sizeof(val));
+    return val;
+}
+uint32_t eeprom_read_dword(const uint32_t *addr) {
+    uint32_t val;
+    eeprom_read_block(&val, addr, sizeof(val));
+    return val;
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    eeprom_writes.push_back({(uintptr_t)addr, len});
+    memcpy(&fake_eeprom[(uintptr_t)addr], buf, len);
+}
+void eeprom_write_byte(uint8_t *addr, uint8_t val) {
+    eeprom_write_block(&val, addr, sizeof(val));
+}
+void eeprom_write_word(uint16_t *addr, uint16_t val) {
+    eeprom_write_block(&val, addr, sizeof(val));
+}
+void eeprom_write_dword(uint32_t *addr, uint32_t val) {
+    eeprom_write_block(&val, addr, sizeof(val));
+}
+
+void eeprom_update_block(const void *buf, void *addr, size_t len) {
+    eeprom_write_block(buf, addr, len);
+}
+void eeprom_update_byte(uint8_t *addr, uint8_t val) {
+    eeprom_write_byte(addr, val);
+}
+void eeprom_update_word(uint16_t *addr, uint16_t val) {
+    eeprom_write_word(addr, val);
+}
+void eeprom_update_dword(uint32_t *addr, uint32_t val) {
+    eeprom_write_dword(addr, val);
+}
+}
+
+// Offsets within eeprom_core_t, see nvm_eeprom_eeconfig_internal.h
+enum : uintptr_t {
+    OFFSET_MAGIC      = 0,
+    OFFSET_DEBUG      = 2,
+    OFFSET_KEYMAP     = 4,
+    OFFSET_HANDEDNESS = 14,
+    OFFSET_KEYBOARD   = 15,
+    BASE_SIZE         = 37,
+};
+
+class NvmEeconfig : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        memset(fake_eeprom, 0, sizeof(fake_eeprom));
+        nvm_eeconfig_erase();
+        eeprom_reads.clear();
+        eeprom_writes.clear();
+        set_time(0);
+    }
+
+    void update_debug(uint8_t raw) {
+        debug_config_t debug_config = {.raw = raw};
+        eeconfig_update_debug(&debug_config);
+    }
+
+    void update_keymap(uint16_t raw) {
+        keymap_config_t keymap_config = {.raw = raw};
+        eeconfig_update_keymap(&keymap_config);
+    }
+};
+
+TEST_F(NvmEeconfig, Reads_ServedFromCache) {
+    fake_eeprom[OFFSET_DEBUG]      = 0x05;
+    fake_eeprom[OFFSET_HANDEDNESS] = 1;
+
+    debug_config_t debug_config;
+    eeconfig_read_debug(&debug_config);
+    EXPECT_EQ(debug_config.raw, 0x05);
+    EXPECT_TRUE(eeconfig_read_handedness());
+    EXPECT_FALSE(eeconfig_is_enabled());
+
+    // The whole core block is read once, and nothing after that
+    ASSERT_EQ(eeprom_reads.size(), 1u);
+    EXPECT_EQ(eeprom_reads[0].addr, 0u);
+    EXPECT_EQ(eeprom_reads[0].len, (size_t)BASE_SIZE);
+}
+
+TEST_F(NvmEeconfig, Updates_CoalescedUntilFlush) {
+    update_keymap(0x1234);
+    update_debug(0x01);
+    eeconfig_update_handedness(true);
+    update_debug(0x03);
+    EXPECT_TRUE(eeprom_writes.empty()) << "Updates stay in RAM until flushed";
+
+    // One write, spanning from the lowest to the highest changed byte
+    eeconfig_flush();
+    ASSERT_EQ(eeprom_writes.size(), 1u);
+    EXPECT_EQ(eeprom_writes[0].addr, OFFSET_DEBUG);
+    EXPECT_EQ(eeprom_writes[0].len, OFFSET_HANDEDNESS + 1 - OFFSET_DEBUG);
+    EXPECT_EQ(fake_eeprom[OFFSET_DEBUG], 0x03);
+    EXPECT_EQ(fake_eeprom[OFFSET_KEYMAP], 0x34);
+    EXPECT_EQ(fake_eeprom[OFFSET_KEYMAP + 1], 0x12);
+    EXPECT_EQ(fake_eeprom[OFFSET_HANDEDNESS], 1);
+
+    // Nothing left to write
+    eeconfig_flush();
+    EXPECT_EQ(eeprom_writes.size(), 1u);
+}
+
+TEST_F(NvmEeconfig, UnchangedValue_NotDirty) {
+    update_debug(0x00);
+    eeconfig_update_handedness(false);
+    eeconfig_flush();
+    EXPECT_TRUE(eeprom_writes.empty());
+
+    // A value changed and then changed back still gets written, but only that byte
+    update_debug(0x01);
+    update_debug(0x00);
+    eeconfig_flush();
+    ASSERT_EQ(eeprom_writes.size(), 1u);
+    EXPECT_EQ(eeprom_writes[0].addr, OFFSET_DEBUG);
+    EXPECT_EQ(eeprom_writes[0].len, 1u);
+}
+
+TEST_F(NvmEeconfig, Task_FlushesOnceIdle) {
+    update_debug(0x01);
+    advance_time(600);
+    update_debug(0x02);
+
+    // Idle time counts from the latest update
+    advance_time(EECONFIG_RAM_CACHE_IDLE_MS - 1);
+    eeconfig_task();
+    EXPECT_TRUE(eeprom_writes.empty());
+
+    advance_time(1);
+    eeconfig_task();
+    ASSERT_EQ(eeprom_writes.size(), 1u);
+    EXPECT_EQ(fake_eeprom[OFFSET_DEBUG], 0x02);
+
+    // Clean cache, nothing to do
+    advance_time(EECONFIG_RAM_CACHE_IDLE_MS);
+    eeconfig_task();
+    EXPECT_EQ(eeprom_writes.size(), 1u);
+}
+
+TEST_F(NvmEeconfig, InitQuantum_SingleCoreWrite) {
+    memset(fake_eeprom, 0xFF, sizeof(fake_eeprom));
+    eeconfig_init_quantum();
+
+    // Apart from the datablock version, the core settings land in one write at the end of init
+    std::vector<eeprom_access_t> core_writes;
+    for (auto &write : eeprom_writes) {
+        if (write.addr < BASE_SIZE && write.addr != OFFSET_KEYBOARD) {
+            core_writes.push_back(write);
+        }
+    }
+    ASSERT_EQ(core_writes.size(), 1u);
+    EXPECT_EQ(core_writes[0].addr, 0u);
+    EXPECT_EQ(eeprom_writes.back().addr, 0u);
+
+    // Everything is in EEPROM without any further flush
+    uint16_t magic;
+    memcpy(&magic, &fake_eeprom[OFFSET_MAGIC], sizeof(magic));
+    EXPECT_EQ(magic, EECONFIG_MAGIC_NUMBER);
+    EXPECT_EQ(fake_eeprom[OFFSET_DEBUG], 0x00);
+    EXPECT_TRUE(eeconfig_is_kb_datablock_valid());
+}
+
+TEST_F(NvmEeconfig, Datablock_WrittenImmediately) {
+    const uint8_t data[EECONFIG_KB_DATA_SIZE] = {1, 2, 3, 4, 5, 6, 7, 8};
+    EXPECT_FALSE(eeconfig_is_kb_datablock_valid());
+    EXPECT_EQ(eeconfig_update_kb_datablock(data, 0, sizeof(data)), sizeof(data));
+
+    // Both the version and the body reach EEPROM straight away
+    uint32_t version;
+    memcpy(&version, &fake_eeprom[OFFSET_KEYBOARD], sizeof(version));
+    EXPECT_EQ(version, (uint32_t)(EECONFIG_KB_DATA_VERSION));
+    EXPECT_EQ(memcmp(&fake_eeprom[BASE_SIZE], data, sizeof(data)), 0);
+    EXPECT_TRUE(eeconfig_is_kb_datablock_valid());
+
+    // ...and the version doesn't linger in the dirty range
+    size_t writes = eeprom_writes.size();
+    eeconfig_flush();
+    EXPECT_EQ(eeprom_writes.size(), writes);
+
+    uint8_t readback[EECONFIG_KB_DATA_SIZE];
+    EXPECT_EQ(eeconfig_read_kb_datablock(readback, 0, sizeof(readback)), sizeof(readback));
+    EXPECT_EQ(memcmp(readback, data, sizeof(data)), 0);
+}
@@ -0,0 +1,8 @@
+nvm_eeconfig_DEFS := -DEEPROM_TEST_HARNESS -DEECONFIG_RAM_CACHE -DEECONFIG_RAM_CACHE_IDLE_MS=1000 -DEECONFIG_KB_DATA_SIZE=8 -DNO_PRINT -DNO_DEBUG
+
+nvm_eeconfig_SRC := \
+	$(QUANTUM_PATH)/nvm/tests/nvm_eeconfig_tests.cpp \
+	$(QUANTUM_PATH)/nvm/eeprom/nvm_eeconfig.c \
+	$(QUANTUM_PATH)/eeconfig.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -0,0 +1 @@
+TEST_LIST += nvm_eeconfig
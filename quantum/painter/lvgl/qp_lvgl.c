@@ -3,10 +3,27 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_lvgl.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
 #include "timer.h"
 #include "deferred_exec.h"
 #include "lvgl.h"
 
+// LVGL renders directly in the native format of RGB565 panels when it swaps the bytes of each color, otherwise each flushed
+// area is converted on its way to the display.
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+#    define QP_LVGL_NATIVE_COLOR TRUE
+#else
+#    define QP_LVGL_NATIVE_COLOR FALSE
+#endif
+
+// Native colors can be sent straight from LVGL's buffer in the background, with LVGL told once the transfer completes
+#if QUANTUM_PAINTER_SPI_ASYNC && QP_LVGL_NATIVE_COLOR
+#    define QP_LVGL_ASYNC_FLUSH TRUE
+#else
+#    define QP_LVGL_ASYNC_FLUSH FALSE
+#endif
+
 typedef struct lvgl_state_t {
     uint8_t        fnc_id; // Ideally this should be the pointer of the function to run
     uint16_t       delay_ms;
@@ -19,16 +36,70 @@ static lvgl_state_t        lvgl_states[2]    = {0}; // For lv_tick_inc and lv_ta
 painter_device_t selected_display = NULL;
 void            *color_buffer     = NULL;
 
+#if QP_LVGL_ASYNC_FLUSH
+static lv_disp_drv_t *pending_flush = NULL; // LVGL's buffer is still being transferred to the display
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter LVGL Integration Internal: qp_lvgl_flush
 
+#if !QP_LVGL_NATIVE_COLOR
+// Converts LVGL's colors to the panel's native format, a pixdata buffer at a time
+static void qp_lvgl_flush_converted(const lv_color_t *color_p, uint32_t number_pixels) {
+    uint32_t pixels_in_buffer = qp_internal_num_pixels_in_buffer(selected_display);
+    while (number_pixels > 0) {
+        uint32_t count = MIN(number_pixels, pixels_in_buffer);
+        for (uint32_t i = 0; i < count; ++i) {
+#    if LV_COLOR_DEPTH == 16
+            ((uint16_t *)qp_internal_global_pixdata_buffer)[i] = __builtin_bswap16(color_p[i].full);
+#    else
+            ((rgb_t *)qp_internal_global_pixdata_buffer)[i] = (rgb_t){.r = color_p[i].ch.red, .g = color_p[i].ch.green, .b = color_p[i].ch.blue};
+#    endif
+        }
+        qp_pixdata(selected_display, qp_internal_global_pixdata_buffer, count);
+        color_p += count;
+        number_pixels -= count;
+    }
+}
+#endif // !QP_LVGL_NATIVE_COLOR
+
+#if QP_LVGL_ASYNC_FLUSH
+// Hands LVGL's buffer back once the background transfer has completed
+static void qp_lvgl_flush_poll(void) {
+    if (pending_flush && !qp_comms_busy(selected_display)) {
+        lv_disp_drv_t *disp = pending_flush;
+        pending_flush       = NULL;
+        lv_disp_flush_ready(disp);
+    }
+}
+
+// Called by LVGL whenever it needs a buffer that is still being flushed
+static void qp_lvgl_flush_wait(lv_disp_drv_t *disp) {
+    qp_lvgl_flush_poll();
+}
+#endif // QP_LVGL_ASYNC_FLUSH
+
 void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
     if (selected_display) {
         uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
         qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
+#if QP_LVGL_ASYNC_FLUSH
+        // Sent in place, LVGL carries on rendering into its other buffer (if any) while this one is transferred
+        qp_internal_async_pixdata_source = color_p;
+        qp_pixdata(selected_display, (void *)color_p, number_pixels);
+        qp_internal_async_pixdata_source = NULL;
+        qp_flush(selected_display);
+        pending_flush = disp;
+        qp_lvgl_flush_poll();
+#elif QP_LVGL_NATIVE_COLOR
         qp_pixdata(selected_display, (void *)color_p, number_pixels);
         qp_flush(selected_display);
         lv_disp_flush_ready(disp);
+#else
+        qp_lvgl_flush_converted(color_p, number_pixels);
+        qp_flush(selected_display);
+        lv_disp_flush_ready(disp);
+#endif
     }
 }
 
@@ -67,6 +138,20 @@ bool qp_lvgl_attach(painter_device_t device) {
         return false;
     }
 
+    // LVGL's colors need to be native to the panel, or convertible to it
+#if LV_COLOR_DEPTH == 16
+    const uint8_t supported_bpp = 16;
+#elif LV_COLOR_DEPTH == 32
+    const uint8_t supported_bpp = 24;
+#else
+    const uint8_t supported_bpp = 0;
+#endif
+    if (driver->native_bits_per_pixel != supported_bpp) {
+        qp_dprintf("qp_lvgl_attach: fail (LV_COLOR_DEPTH %d unsupported with a %d bpp display)\n", (int)LV_COLOR_DEPTH, (int)driver->native_bits_per_pixel);
+        qp_lvgl_detach();
+        return false;
+    }
+
     // Setting up the tasks
     lvgl_state_t *lv_tick_inc_state = &lvgl_states[0];
     lv_tick_inc_state->fnc_id       = 0;
@@ -95,18 +180,23 @@ bool qp_lvgl_attach(painter_device_t device) {
 
     // Set up lvgl display buffer
     static lv_disp_draw_buf_t draw_buf;
-    // Allocate a buffer for 1/10 screen size
-    const size_t count_required   = driver->panel_width * driver->panel_height / 10;
-    void        *new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required);
+    // Allocate a buffer for 1/10 screen size, or two of them when double-buffering
+    const size_t count_required = driver->panel_width * driver->panel_height / 10;
+#if QP_LVGL_DOUBLE_BUFFER
+    const size_t buffer_count = 2;
+#else
+    const size_t buffer_count = 1;
+#endif
+    void *new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required * buffer_count);
     if (!new_color_buffer) {
         qp_dprintf("qp_lvgl_attach: fail (could not set up memory buffer)\n");
         qp_lvgl_detach();
         return false;
     }
     color_buffer = new_color_buffer;
-    memset(color_buffer, 0, sizeof(lv_color_t) * count_required);
+    memset(color_buffer, 0, sizeof(lv_color_t) * count_required * buffer_count);
     // Initialize the display buffer.
-    lv_disp_draw_buf_init(&draw_buf, color_buffer, NULL, count_required);
+    lv_disp_draw_buf_init(&draw_buf, color_buffer, buffer_count > 1 ? (lv_color_t *)color_buffer + count_required : NULL, count_required);
 
     selected_display = device;
 
@@ -120,6 +210,9 @@ bool qp_lvgl_attach(painter_device_t device) {
     disp_drv.draw_buf = &draw_buf;     /*Assign the buffer to the display*/
     disp_drv.hor_res  = panel_width;   /*Set the horizontal resolution of the display*/
     disp_drv.ver_res  = panel_height;  /*Set the vertical resolution of the display*/
+#if QP_LVGL_ASYNC_FLUSH
+    disp_drv.wait_cb = qp_lvgl_flush_wait; /*Polls for the completion of background flushes*/
+#endif
     lv_disp_drv_register(&disp_drv);   /*Finally register the driver*/
 
     return true;
@@ -132,6 +225,14 @@ void qp_lvgl_detach(void) {
     for (int i = 0; i < 2; ++i) {
         cancel_deferred_exec_advanced(lvgl_executors, 2, lvgl_states[i].defer_token);
     }
+#if QP_LVGL_ASYNC_FLUSH
+    // The buffer can't be released while it's still being transferred
+    if (pending_flush) {
+        while (qp_comms_busy(selected_display)) {
+        }
+        pending_flush = NULL;
+    }
+#endif
     if (color_buffer) {
         free(color_buffer);
         color_buffer = NULL;
@@ -144,5 +245,8 @@ void qp_lvgl_detach(void) {
 
 void qp_lvgl_internal_tick(void) {
     static uint32_t last_lvgl_exec = 0;
+#if QP_LVGL_ASYNC_FLUSH
+    qp_lvgl_flush_poll();
+#endif
     deferred_exec_advanced_task(lvgl_executors, 2, &last_lvgl_exec);
 }
@@ -11,6 +11,15 @@
 #    define QP_LVGL_TASK_PERIOD 5
 #endif
 
+#ifndef QP_LVGL_DOUBLE_BUFFER
+/**
+ * @def This controls whether LVGL is given a second draw buffer, so that it can render the next area while the previous
+ *      one is still being transferred to the display in the background (see QUANTUM_PAINTER_SPI_ASYNC). Doubles the RAM
+ *      used for LVGL's draw buffer.
+ */
+#    define QP_LVGL_DOUBLE_BUFFER FALSE
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter - LVGL External API
 
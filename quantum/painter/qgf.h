@@ -125,6 +125,12 @@ typedef struct PACKED qgf_data_v1_t {
 
 STATIC_ASSERT(sizeof(qgf_data_v1_t) == sizeof(qgf_block_header_v1_t), "qgf_data_v1_t must only contain qgf_block_header_v1_t in v1 of QGF");
 
+/////////////////////////////////////////
+// LZ compression parameters
+
+#define QGF_LZ_WINDOW_SIZE 1024 // Maximum distance back that a match may reference, must be a power of two
+#define QGF_LZ_MIN_MATCH 4      // Length of the shortest match, added to the match length encoded in the token
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QGF API
 
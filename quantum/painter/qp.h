@@ -56,6 +56,51 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_FLASH_READ_AHEAD_SIZE
+/**
+ * @def This controls the size (in bytes) of the read-ahead buffer held by each image or font loaded from external
+ *      flash using \ref qp_load_image_flash or \ref qp_load_font_flash. Reads are issued to the flash a whole buffer at a
+ *      time, so larger buffers mean fewer flash transactions when decoding, at the cost of RAM for every image and font
+ *      slot. Only used if external flash support is enabled.
+ */
+#    define QUANTUM_PAINTER_FLASH_READ_AHEAD_SIZE 64
+#endif // QUANTUM_PAINTER_FLASH_READ_AHEAD_SIZE
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the amount of RAM (in bytes) reserved for caching decoded font glyphs in the display's native
+ *      pixel format. Repeatedly drawn glyphs are then sent straight to the display without re-reading or re-decoding
+ *      the font. Least-recently-used glyphs are evicted when full. Must not exceed 65535. Defaults to 0, disabled.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls the maximum number of glyphs held in the glyph cache, regardless of their size. Only used if
+ *      \ref QUANTUM_PAINTER_GLYPH_CACHE_SIZE is non-zero.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 32
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+
+#ifndef QUANTUM_PAINTER_NUM_TEXT_RUNS
+/**
+ * @def This controls the maximum number of text runs that can be created with \ref qp_make_text_run. The rendered
+ *      pixels of each text run are allocated from the heap when it is created. Defaults to 0, disabled.
+ */
+#    define QUANTUM_PAINTER_NUM_TEXT_RUNS 0
+#endif // QUANTUM_PAINTER_NUM_TEXT_RUNS
+
+#ifndef QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES
+/**
+ * @def This controls the number of interpolated palettes kept in the display's native format, keyed by foreground and
+ *      background color, palette size, and display. Drawing alternates between several recolored fonts or images can
+ *      then reuse earlier conversions instead of repeating them. Palettes of up to 16 entries (4bpp) are cached, each
+ *      cache entry requiring roughly 80 bytes of RAM. Set to 0 to disable.
+ */
+#    define QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES 4
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +117,16 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_SPI_ASYNC
+/**
+ * @def This controls whether pixel data is streamed to SPI displays in the background (using DMA, where the platform
+ *      supports it). The pixel data buffer is double-buffered so the next block can be prepared while the previous one
+ *      is transmitted, requiring twice the RAM. The final transfer of each drawing operation completes in the
+ *      background, and is finalised by the Quantum Painter internal task or the next SPI operation.
+ */
+#    define QUANTUM_PAINTER_SPI_ASYNC FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -80,6 +135,14 @@
 #    define QUANTUM_PAINTER_SUPPORTS_256_PALETTE FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_SUPPORTS_LZ
+/**
+ * @def This controls whether LZ-compressed images are supported. Decoding requires a 1kB window of previously decoded
+ *      data to be held in RAM.
+ */
+#    define QUANTUM_PAINTER_SUPPORTS_LZ FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS
 /**
  * @def This controls whether the native color range is supported. This avoids the use of palettes but each image
@@ -129,6 +192,19 @@ typedef struct painter_font_desc_t {
  */
 typedef const painter_font_desc_t *painter_font_handle_t;
 
+/**
+ * @typedef A descriptor for a Quantum Painter text run.
+ */
+typedef struct painter_text_run_desc_t {
+    uint16_t width;  ///< The width of the rendered text, in pixels
+    uint8_t  height; ///< The height of the rendered text, in pixels
+} painter_text_run_desc_t;
+
+/**
+ * @typedef A handle to a Quantum Painter text run.
+ */
+typedef const painter_text_run_desc_t *painter_text_run_handle_t;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API
 
@@ -263,6 +339,28 @@ bool qp_setpixel(painter_device_t device, uint16_t x, uint16_t y, uint8_t hue, u
  */
 bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val);
 
+/**
+ * Draws an anti-aliased line, blending the foreground color towards the background color at its edges.
+ *
+ * @note Intended for RGB panels, drawing over a solid background matching the background color. Partially covered pixels
+ *       next to the line are written with the background color, but nothing outside the line's bounding box is touched.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x0[in] the device's x-position to start
+ * @param y0[in] the device's y-position to start
+ * @param x1[in] the device's x-position to finish
+ * @param y1[in] the device's y-position to finish
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ * @return true if drawing the line succeeded
+ * @return false if drawing the line failed
+ */
+bool qp_line_aa(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
 /**
  * Draws a rectangle using the specified color, optionally filled.
  *
@@ -296,6 +394,26 @@ bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t righ
  */
 bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
 
+/**
+ * Draws an anti-aliased circle outline, blending the foreground color towards the background color at its edges.
+ *
+ * @note Intended for RGB panels, drawing over a solid background matching the background color.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x[in] the x-position of the centre of the circle to draw onto the device
+ * @param y[in] the y-position of the centre of the circle to draw onto the device
+ * @param radius[in] the radius of the circle to draw, from 1 to 4095
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ * @return true if drawing the circle succeeded
+ * @return false if drawing the circle failed
+ */
+bool qp_circle_aa(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
 /**
  * Draws a ellipse using the specified color, optionally filled.
  *
@@ -353,6 +471,21 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
  */
 painter_image_handle_t qp_load_image_mem(const void *buffer);
 
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+/**
+ * Loads an image stored in external flash. The image data is read through the flash driver as it's drawn, rather than
+ * needing to be memory-mapped.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image.
+ *
+ * @param address[in] the flash address of the image data, such as one returned by \ref qp_flash_asset_address
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash(uint32_t address);
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
+
 /**
  * Closes an image handle when no longer in use.
  *
@@ -440,6 +573,20 @@ void qp_stop_animation(deferred_token anim_token);
  */
 painter_font_handle_t qp_load_font_mem(const void *buffer);
 
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+/**
+ * Loads a font stored in external flash. The font data is read through the flash driver as it's drawn, rather than
+ * needing to be memory-mapped.
+ *
+ * @note Fonts can be unloaded by calling \ref qp_close_font.
+ *
+ * @param address[in] the flash address of the font data, such as one returned by \ref qp_flash_asset_address
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if loading the font failed
+ */
+painter_font_handle_t qp_load_font_flash(uint32_t address);
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
+
 /**
  * Closes a font handle when no longer in use.
  *
@@ -488,6 +635,49 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
  */
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
 
+#if QUANTUM_PAINTER_NUM_TEXT_RUNS > 0
+
+/**
+ * Renders text into RAM in the device's native pixel format, so that it can be redrawn without touching the font.
+ *
+ * @note Text runs can be released by calling \ref qp_close_text_run.
+ *
+ * @param device[in] the handle of the device the text run will be drawn to
+ * @param font[in] the handle of the font
+ * @param str[in] the string to render
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ * @return a text run handle usable with \ref qp_drawtext_run
+ * @return NULL if rendering the text failed
+ */
+painter_text_run_handle_t qp_make_text_run(painter_device_t device, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+/**
+ * Draws a previously rendered text run to the display.
+ *
+ * @param device[in] the handle of the device to control, which must match the one the text run was made for
+ * @param x[in] the x-position where the text should be drawn onto the device
+ * @param y[in] the y-position where the text should be drawn onto the device
+ * @param run[in] the handle of the text run
+ * @return the width (in pixels) used when drawing the text run
+ */
+int16_t qp_drawtext_run(painter_device_t device, uint16_t x, uint16_t y, painter_text_run_handle_t run);
+
+/**
+ * Releases a text run when no longer in use.
+ *
+ * @param run[in] the handle of the text run to release
+ * @return true if releasing the text run succeeded
+ * @return false if releasing the text run failed
+ */
+bool qp_close_text_run(painter_text_run_handle_t run);
+
+#endif // QUANTUM_PAINTER_NUM_TEXT_RUNS > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Drivers
 
@@ -572,6 +762,14 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Extras
 
+#ifdef QUANTUM_PAINTER_DISPLAY_LIST_ENABLE
+#    include "qp_display_list.h"
+#endif // QUANTUM_PAINTER_DISPLAY_LIST_ENABLE
+
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+#    include "qp_flash_assets.h"
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
+
 #ifdef QUANTUM_PAINTER_LVGL_INTEGRATION_ENABLE
 #    include "qp_lvgl.h"
 #endif // QUANTUM_PAINTER_LVGL_INTEGRATION_ENABLE
@@ -15,6 +15,12 @@ bool     qp_comms_init(painter_device_t device);
 bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
+bool     qp_comms_busy(painter_device_t device);
+
+// Releases the bus held by whichever device is mid-draw, e.g. to read an asset from flash sharing its SPI bus, returning
+// that device (or NULL if none) so that qp_comms_resume() can reopen its comms afterwards
+painter_device_t qp_comms_suspend(void);
+bool             qp_comms_resume(painter_device_t device);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
@@ -0,0 +1,227 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "qp_internal.h"
+#include "qp_display_list.h"
+#include "qp_surface_internal.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Recording
+
+void qp_display_list_init(qp_display_list_t *list, qp_display_list_op_t *ops, uint16_t capacity, uint8_t hue, uint8_t sat, uint8_t val) {
+    list->ops        = ops;
+    list->capacity   = capacity;
+    list->count      = 0;
+    list->background = (hsv_t){.h = hue, .s = sat, .v = val};
+}
+
+void qp_display_list_clear(qp_display_list_t *list) {
+    list->count = 0;
+}
+
+// Lowest coordinate covered by something extending the supplied distance from a centre point
+static inline uint16_t qp_display_list_extent_lo(uint16_t centre, uint16_t size) {
+    return centre > size ? centre - size : 0;
+}
+
+static inline uint16_t qp_display_list_extent_hi(uint16_t centre, uint16_t size) {
+    return ((uint32_t)centre) + size < UINT16_MAX ? centre + size : UINT16_MAX;
+}
+
+// Reserves the next operation, with its bounding box and color filled in
+static qp_display_list_op_t *qp_display_list_append(qp_display_list_t *list, uint8_t type, uint16_t l, uint16_t t, uint16_t r, uint16_t b, uint8_t hue, uint8_t sat, uint8_t val) {
+    if (list->count >= list->capacity) {
+        qp_dprintf("qp_display_list_append: fail (display list full)\n");
+        return NULL;
+    }
+
+    qp_display_list_op_t *op = &list->ops[list->count++];
+    op->type                 = type;
+    op->filled               = false;
+    op->l                    = MIN(l, r);
+    op->t                    = MIN(t, b);
+    op->r                    = MAX(l, r);
+    op->b                    = MAX(t, b);
+    op->fg                   = (hsv_t){.h = hue, .s = sat, .v = val};
+    return op;
+}
+
+bool qp_display_list_rect(qp_display_list_t *list, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    qp_display_list_op_t *op = qp_display_list_append(list, QP_DISPLAY_LIST_RECT, left, top, right, bottom, hue, sat, val);
+    if (!op) {
+        return false;
+    }
+    op->filled = filled;
+    return true;
+}
+
+bool qp_display_list_line(qp_display_list_t *list, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val) {
+    qp_display_list_op_t *op = qp_display_list_append(list, QP_DISPLAY_LIST_LINE, x0, y0, x1, y1, hue, sat, val);
+    if (!op) {
+        return false;
+    }
+    op->line.x0 = x0;
+    op->line.y0 = y0;
+    op->line.x1 = x1;
+    op->line.y1 = y1;
+    return true;
+}
+
+bool qp_display_list_circle(qp_display_list_t *list, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    qp_display_list_op_t *op = qp_display_list_append(list, QP_DISPLAY_LIST_CIRCLE, qp_display_list_extent_lo(x, radius), qp_display_list_extent_lo(y, radius), qp_display_list_extent_hi(x, radius), qp_display_list_extent_hi(y, radius), hue, sat, val);
+    if (!op) {
+        return false;
+    }
+    op->filled        = filled;
+    op->ellipse.x     = x;
+    op->ellipse.y     = y;
+    op->ellipse.sizex = radius;
+    op->ellipse.sizey = radius;
+    return true;
+}
+
+bool qp_display_list_ellipse(qp_display_list_t *list, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    qp_display_list_op_t *op = qp_display_list_append(list, QP_DISPLAY_LIST_ELLIPSE, qp_display_list_extent_lo(x, sizex), qp_display_list_extent_lo(y, sizey), qp_display_list_extent_hi(x, sizex), qp_display_list_extent_hi(y, sizey), hue, sat, val);
+    if (!op) {
+        return false;
+    }
+    op->filled        = filled;
+    op->ellipse.x     = x;
+    op->ellipse.y     = y;
+    op->ellipse.sizex = sizex;
+    op->ellipse.sizey = sizey;
+    return true;
+}
+
+bool qp_display_list_drawimage(qp_display_list_t *list, uint16_t x, uint16_t y, painter_image_handle_t image) {
+    if (!image || image->width == 0 || image->height == 0) {
+        qp_dprintf("qp_display_list_drawimage: fail (invalid image)\n");
+        return false;
+    }
+
+    qp_display_list_op_t *op = qp_display_list_append(list, QP_DISPLAY_LIST_IMAGE, x, y, qp_display_list_extent_hi(x, image->width - 1), qp_display_list_extent_hi(y, image->height - 1), 0, 0, 0);
+    if (!op) {
+        return false;
+    }
+    op->image.x     = x;
+    op->image.y     = y;
+    op->image.image = image;
+    return true;
+}
+
+bool qp_display_list_drawtext_recolor(qp_display_list_t *list, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    // Measure up front, so that tiles the text doesn't touch can skip it without walking the string
+    int16_t width = qp_textwidth(font, str);
+    if (width <= 0) {
+        qp_dprintf("qp_display_list_drawtext_recolor: fail (nothing to render)\n");
+        return false;
+    }
+
+    qp_display_list_op_t *op = qp_display_list_append(list, QP_DISPLAY_LIST_TEXT, x, y, qp_display_list_extent_hi(x, width - 1), qp_display_list_extent_hi(y, font->line_height - 1), hue_fg, sat_fg, val_fg);
+    if (!op) {
+        return false;
+    }
+    op->bg        = (hsv_t){.h = hue_bg, .s = sat_bg, .v = val_bg};
+    op->text.x    = x;
+    op->text.y    = y;
+    op->text.font = font;
+    op->text.str  = str;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Rendering
+
+static bool qp_display_list_render_op(const qp_display_list_op_t *op, painter_device_t tile, uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    switch (op->type) {
+        case QP_DISPLAY_LIST_RECT:
+            if (op->filled) {
+                // Only fill the part within the tile, as everything else would be discarded anyway
+                return qp_rect(tile, MAX(op->l, l), MAX(op->t, t), MIN(op->r, r), MIN(op->b, b), op->fg.h, op->fg.s, op->fg.v, true);
+            }
+            return qp_rect(tile, op->l, op->t, op->r, op->b, op->fg.h, op->fg.s, op->fg.v, false);
+        case QP_DISPLAY_LIST_LINE:
+            return qp_line(tile, op->line.x0, op->line.y0, op->line.x1, op->line.y1, op->fg.h, op->fg.s, op->fg.v);
+        case QP_DISPLAY_LIST_CIRCLE:
+            return qp_circle(tile, op->ellipse.x, op->ellipse.y, op->ellipse.sizex, op->fg.h, op->fg.s, op->fg.v, op->filled);
+        case QP_DISPLAY_LIST_ELLIPSE:
+            return qp_ellipse(tile, op->ellipse.x, op->ellipse.y, op->ellipse.sizex, op->ellipse.sizey, op->fg.h, op->fg.s, op->fg.v, op->filled);
+        case QP_DISPLAY_LIST_IMAGE:
+            return qp_drawimage(tile, op->image.x, op->image.y, op->image.image);
+        case QP_DISPLAY_LIST_TEXT:
+            return qp_drawtext_recolor(tile, op->text.x, op->text.y, op->text.font, op->text.str, op->fg.h, op->fg.s, op->fg.v, op->bg.h, op->bg.s, op->bg.v) > 0;
+        default:
+            return false;
+    }
+}
+
+static bool qp_display_list_render_tile(qp_display_list_t *list, painter_device_t tile, painter_device_t target, uint16_t l, uint16_t t) {
+    uint16_t r = l + qp_get_width(tile) - 1;
+    uint16_t b = t + qp_get_height(tile) - 1;
+
+    // Clearing marks the whole tile as dirty, so it's sent even if it ends up identical to the previous one
+    bool ok = qp_clear(tile);
+
+    // Draw in display coordinates, anything outside the tile is dropped by the surface
+    qp_surface_set_origin(tile, l, t);
+    ok = ok && qp_rect(tile, l, t, r, b, list->background.h, list->background.s, list->background.v, true);
+    for (uint16_t i = 0; ok && i < list->count; ++i) {
+        const qp_display_list_op_t *op = &list->ops[i];
+        if (op->r < l || op->l > r || op->b < t || op->t > b) {
+            continue;
+        }
+        ok = qp_display_list_render_op(op, tile, l, t, r, b);
+    }
+    qp_surface_set_origin(tile, 0, 0);
+
+    if (!ok) {
+        qp_dprintf("qp_display_list_render: fail (could not draw tile at %d,%d)\n", (int)l, (int)t);
+        return false;
+    }
+
+    // Every pixel of the tile was redrawn, so send all of it
+    return qp_surface_draw(tile, target, l, t, true);
+}
+
+bool qp_display_list_render_region(qp_display_list_t *list, painter_device_t tile, painter_device_t target, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    qp_dprintf("qp_display_list_render_region(%d, %d, %d, %d): entry\n", (int)left, (int)top, (int)right, (int)bottom);
+    painter_driver_t *tile_driver   = (painter_driver_t *)tile;
+    painter_driver_t *target_driver = (painter_driver_t *)target;
+    if (!tile_driver || !tile_driver->validate_ok || !target_driver || !target_driver->validate_ok) {
+        qp_dprintf("qp_display_list_render_region: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    uint16_t tile_w   = qp_get_width(tile);
+    uint16_t tile_h   = qp_get_height(tile);
+    uint16_t target_w = qp_get_width(target);
+    uint16_t target_h = qp_get_height(target);
+    if (tile_w > target_w || tile_h > target_h) {
+        qp_dprintf("qp_display_list_render_region: fail (tile larger than target)\n");
+        return false;
+    }
+
+    right  = MIN(right, target_w - 1);
+    bottom = MIN(bottom, target_h - 1);
+    if (left > right || top > bottom) {
+        qp_dprintf("qp_display_list_render_region: ok (nothing to render)\n");
+        return true;
+    }
+
+    // Walk the region in tile-sized steps. Tiles that would hang off the edge of the target are pulled back inside it
+    // instead, re-sending a few pixels that are already correct rather than needing a differently-sized tile.
+    for (uint32_t y = top; y <= bottom; y += tile_h) {
+        for (uint32_t x = left; x <= right; x += tile_w) {
+            if (!qp_display_list_render_tile(list, tile, target, MIN(x, target_w - tile_w), MIN(y, target_h - tile_h))) {
+                return false;
+            }
+        }
+    }
+
+    qp_dprintf("qp_display_list_render_region: ok\n");
+    return true;
+}
+
+bool qp_display_list_render(qp_display_list_t *list, painter_device_t tile, painter_device_t target) {
+    return qp_display_list_render_region(list, tile, target, 0, 0, UINT16_MAX, UINT16_MAX);
+}
@@ -0,0 +1,164 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "color.h"
+#include "qp.h"
+
+/*
+    Tiled rendering for displays too large to hold a full framebuffer in RAM.
+
+    Drawing operations are recorded into a display list rather than sent straight to the panel. When rendered, the
+    display is split into tiles the size of a small surface: each tile is cleared to the background, every recorded
+    operation overlapping it is drawn in order, and the finished tile is sent to the panel in one transfer. Overlapping
+    widgets are composited in RAM, so the panel never shows a partially drawn frame, and the RAM required is bounded
+    by the tile size rather than the display size.
+
+    Images, fonts and strings are referenced, not copied, and must remain valid until the list is cleared.
+*/
+
+typedef enum {
+    QP_DISPLAY_LIST_RECT,
+    QP_DISPLAY_LIST_LINE,
+    QP_DISPLAY_LIST_CIRCLE,
+    QP_DISPLAY_LIST_ELLIPSE,
+    QP_DISPLAY_LIST_IMAGE,
+    QP_DISPLAY_LIST_TEXT,
+} qp_display_list_op_type_t;
+
+typedef struct qp_display_list_op_t {
+    uint8_t type;
+    bool    filled;
+
+    // Bounding box of the operation, used to skip tiles it doesn't touch
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+
+    hsv_t fg;
+    hsv_t bg;
+
+    union {
+        struct {
+            uint16_t x0;
+            uint16_t y0;
+            uint16_t x1;
+            uint16_t y1;
+        } line;
+        struct {
+            uint16_t x;
+            uint16_t y;
+            uint16_t sizex;
+            uint16_t sizey;
+        } ellipse;
+        struct {
+            uint16_t               x;
+            uint16_t               y;
+            painter_image_handle_t image;
+        } image;
+        struct {
+            uint16_t              x;
+            uint16_t              y;
+            painter_font_handle_t font;
+            const char           *str;
+        } text;
+    };
+} qp_display_list_op_t;
+
+typedef struct qp_display_list_t {
+    qp_display_list_op_t *ops;
+    uint16_t              capacity;
+    uint16_t              count;
+    hsv_t                 background;
+} qp_display_list_t;
+
+/**
+ * Prepares a display list for recording.
+ *
+ * @param list[in] the display list to initialise
+ * @param ops[in] pointer to a preallocated array of operations
+ * @param capacity[in] the number of operations in the array
+ * @param hue[in] the background hue each tile is cleared to before drawing, with 0-360 mapped to 0-255
+ * @param sat[in] the background saturation, with 0-100% mapped to 0-255
+ * @param val[in] the background value, with 0-100% mapped to 0-255
+ */
+void qp_display_list_init(qp_display_list_t *list, qp_display_list_op_t *ops, uint16_t capacity, uint8_t hue, uint8_t sat, uint8_t val);
+
+/**
+ * Removes all recorded operations, ready for the next frame.
+ *
+ * @param list[in] the display list to clear
+ */
+void qp_display_list_clear(qp_display_list_t *list);
+
+/**
+ * Records a rectangle, as per \ref qp_rect.
+ *
+ * @return false if the display list is full
+ */
+bool qp_display_list_rect(qp_display_list_t *list, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Records a line, as per \ref qp_line.
+ *
+ * @return false if the display list is full
+ */
+bool qp_display_list_line(qp_display_list_t *list, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val);
+
+/**
+ * Records a circle, as per \ref qp_circle.
+ *
+ * @return false if the display list is full
+ */
+bool qp_display_list_circle(qp_display_list_t *list, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Records an ellipse, as per \ref qp_ellipse.
+ *
+ * @return false if the display list is full
+ */
+bool qp_display_list_ellipse(qp_display_list_t *list, uint16_t x, uint16_t y, uint16_t sizex, uint16_t sizey, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Records an image, as per \ref qp_drawimage. The image must remain open until the list is cleared.
+ *
+ * @return false if the display list is full, or the image is invalid
+ */
+bool qp_display_list_drawimage(qp_display_list_t *list, uint16_t x, uint16_t y, painter_image_handle_t image);
+
+/**
+ * Records a string of text, as per \ref qp_drawtext_recolor. The font and string must remain valid until the list is
+ * cleared.
+ *
+ * @return false if the display list is full, or the string could not be measured
+ */
+bool qp_display_list_drawtext_recolor(qp_display_list_t *list, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+/**
+ * Renders the region of the display covered by the supplied rectangle, one tile at a time. Tiles may extend past the
+ * region, but always lie within the target.
+ *
+ * @param list[in] the display list to render
+ * @param tile[in] a surface with the same bit depth as the target, no larger than the target, used as the tile buffer
+ * @param target[in] the device to render to
+ * @param left[in] the target's x-position to start
+ * @param top[in] the target's y-position to start
+ * @param right[in] the target's x-position to finish
+ * @param bottom[in] the target's y-position to finish
+ * @return true if rendering succeeded
+ */
+bool qp_display_list_render_region(qp_display_list_t *list, painter_device_t tile, painter_device_t target, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
+
+/**
+ * Renders the entire display, one tile at a time.
+ *
+ * @param list[in] the display list to render
+ * @param tile[in] a surface with the same bit depth as the target, no larger than the target, used as the tile buffer
+ * @param target[in] the device to render to
+ * @return true if rendering succeeded
+ */
+bool qp_display_list_render(qp_display_list_t *list, painter_device_t tile, painter_device_t target);
@@ -10,7 +10,20 @@
 // Quantum Painter utility functions
 
 // Global variable used for native pixel data streaming.
+#if QUANTUM_PAINTER_SPI_ASYNC
+// Points at whichever half of the double buffer is not currently being transmitted.
+extern uint8_t *qp_internal_global_pixdata_buffer;
+
+// Switches the global pixdata buffer over to the other half of the double buffer, so that the current one can be transmitted in the background.
+// Only the pixels written by the last qp_internal_fill_pixdata() are carried across.
+void qp_internal_swap_pixdata_buffer(void);
+
+// A caller-owned buffer which may also be transmitted in the background, without being copied. The caller must leave its
+// contents untouched until qp_comms_busy() reports the transfer has completed.
+extern const void *qp_internal_async_pixdata_source;
+#else
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -27,6 +40,38 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 // qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
+// Coalesces horizontal spans into as few rectangles as possible before sending them with qp_internal_fillrect_helper_impl.
+// Spans on the same row that touch are joined, as are identical spans on adjacent rows, so a run of single pixels along a row or column becomes one transfer.
+typedef struct qp_internal_span_batch_t {
+    bool     active;
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} qp_internal_span_batch_t;
+
+bool qp_internal_span_batch_add(painter_device_t device, qp_internal_span_batch_t* batch, uint16_t l, uint16_t r, uint16_t y);
+bool qp_internal_span_batch_flush(painter_device_t device, qp_internal_span_batch_t* batch);
+
+// Anti-aliased band of up to QP_INTERNAL_AA_MAX_RUN samples along a row (or column), each covering a near pixel and optionally the adjacent far one.
+// Coverage levels index the 16-entry interpolated palette; the far pixel receives the remainder of the near pixel's coverage.
+#define QP_INTERNAL_AA_LEVELS 16
+#define QP_INTERNAL_AA_MAX_RUN 32
+
+typedef struct qp_internal_aa_band_t {
+    bool     vertical; // samples run down a column rather than along a row
+    bool     reversed; // samples run towards lower coordinates
+    int8_t   far_step; // offset of the far row/column from the near one, or 0 if there isn't one
+    uint16_t major;    // lowest coordinate covered along the run
+    uint16_t minor;    // coordinate of the near row/column
+    uint8_t  length;
+    uint8_t  levels[QP_INTERNAL_AA_MAX_RUN]; // coverage of the near pixel for each sample
+} qp_internal_aa_band_t;
+
+// Prepares the global palette for anti-aliased drawing, from background (level 0) to foreground (level 15)
+bool qp_internal_aa_prepare_palette(painter_device_t device, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+bool qp_internal_aa_band_draw(painter_device_t device, const qp_internal_aa_band_t* band);
+
 // Convert from input pixel data + palette to equivalent pixels
 typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
 typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
@@ -51,6 +96,21 @@ bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888,
 // Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
 void qp_internal_invalidate_palette(void);
 
+// Sets up the global palette with the supplied device's native equivalent of the interpolation between two colors.
+// Recently used palettes are cached per device, see QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES. Returns false if the conversion failed.
+bool qp_internal_prepare_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps);
+
+typedef struct qp_palette_cache_stats_t {
+    uint32_t hits;   // palettes reused without conversion
+    uint32_t misses; // palettes interpolated and converted
+} qp_palette_cache_stats_t;
+
+// Palette cache effectiveness, since startup or the last clear
+const qp_palette_cache_stats_t* qp_internal_palette_cache_get_stats(void);
+
+// Empties the palette cache and resets its statistics
+void qp_internal_palette_cache_clear(void);
+
 // Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset. Expects the stream to be positioned at the start of the block header.
 bool qp_internal_load_qgf_palette(qp_stream_t* stream, uint8_t bpp);
 
@@ -63,6 +123,11 @@ enum qp_internal_rle_mode_t {
     NON_REPEATING_RUN,
 };
 
+enum qp_internal_lz_mode_t {
+    LZ_TOKEN,
+    LZ_MATCH,
+};
+
 typedef struct qp_internal_byte_input_state_t {
     painter_device_t device;
     qp_stream_t*     src_stream;
@@ -73,6 +138,15 @@ typedef struct qp_internal_byte_input_state_t {
             enum qp_internal_rle_mode_t mode;
             uint8_t                     remain; // number of bytes remaining in the current mode
         } rle;
+        // LZ-specific
+        struct {
+            enum qp_internal_lz_mode_t mode;
+            uint8_t                    token;
+            uint16_t                   offset;         // distance back into the window for the current match
+            uint32_t                   window_pos;     // number of bytes decoded so far, the window write position is taken from it
+            uint32_t                   literal_remain; // number of literal bytes remaining in the current sequence
+            uint32_t                   match_remain;   // number of bytes remaining in the current match
+        } lz;
     };
 } qp_internal_byte_input_state_t;
 
@@ -8,7 +8,7 @@
 #include "qp_draw.h"
 
 // Utilize 8-way symmetry to draw circles
-static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+static bool qp_circle_helper_impl(painter_device_t device, qp_internal_span_batch_t *batches, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
     /*
     Circles have the property of 8-way symmetry, so eight pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
@@ -17,6 +17,12 @@ static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uin
     For filled circles, we can draw horizontal lines between each pair of
     pixels with the same final value of y.
 
+    Each of the symmetric points (or lines) is fed to its own batch, which
+    coalesces consecutive points into runs along a row or column, and
+    consecutive lines of the same width into rectangles. Lines at
+    [centery +/- offsety] only ever grow wider while offsety stays the same,
+    so only the widest one is transferred.
+
     Two special cases exist and have been optimized:
     1) offsetx == offsety (the final point), makes half the coordinates
     equivalent, so we can omit them (and the corresponding fill lines)
@@ -24,102 +30,39 @@ static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uin
     would be a single pixel in length, so we write individual pixels instead.
     This also makes half the symmetrical points identical to their twins,
     so we only need four points or two points and one line
-    */
 
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t xpy = ((int16_t)centerx) + ((int16_t)offsety);
-    int16_t xmy = ((int16_t)centerx) - ((int16_t)offsety);
-    int16_t ypx = ((int16_t)centery) + ((int16_t)offsetx);
-    int16_t ymx = ((int16_t)centery) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
+    Points past the diagonal are mirror images of ones already drawn, and are
+    skipped.
+    */
 
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, centerx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
-            return false;
-        }
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, centery, xmy, centery)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, centery)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, centery)) {
-                return false;
-            }
-        }
-    } else if (offsetx == offsety) {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypy, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymy, xmy, ymy)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
-                return false;
-            }
-        }
+    if (offsetx > offsety) {
+        return true;
+    }
 
-    } else {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypx, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymx, xmy, ymx)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
-                return false;
-            }
+    uint16_t xpx = centerx + offsetx;
+    uint16_t xmx = centerx - offsetx;
+    uint16_t xpy = centerx + offsety;
+    uint16_t xmy = centerx - offsety;
+    uint16_t ypx = centery + offsetx;
+    uint16_t ymx = centery - offsetx;
+    uint16_t ypy = centery + offsety;
+    uint16_t ymy = centery - offsety;
+
+    if (filled) {
+        if (offsetx == 0) {
+            return qp_internal_span_batch_add(device, &batches[0], centerx, centerx, ypy) && qp_internal_span_batch_add(device, &batches[1], centerx, centerx, ymy) && qp_internal_span_batch_add(device, &batches[2], xmy, xpy, centery);
+        } else if (offsetx == offsety) {
+            return qp_internal_span_batch_add(device, &batches[0], xmy, xpy, ypy) && qp_internal_span_batch_add(device, &batches[1], xmy, xpy, ymy);
         }
+        return qp_internal_span_batch_add(device, &batches[0], xmx, xpx, ypy) && qp_internal_span_batch_add(device, &batches[1], xmx, xpx, ymy) && qp_internal_span_batch_add(device, &batches[2], xmy, xpy, ypx) && qp_internal_span_batch_add(device, &batches[3], xmy, xpy, ymx);
     }
 
-    return true;
+    if (offsetx == 0) {
+        return qp_internal_span_batch_add(device, &batches[0], centerx, centerx, ypy) && qp_internal_span_batch_add(device, &batches[2], centerx, centerx, ymy) && qp_internal_span_batch_add(device, &batches[4], xpy, xpy, centery) && qp_internal_span_batch_add(device, &batches[5], xmy, xmy, centery);
+    } else if (offsetx == offsety) {
+        return qp_internal_span_batch_add(device, &batches[0], xpy, xpy, ypy) && qp_internal_span_batch_add(device, &batches[1], xmy, xmy, ypy) && qp_internal_span_batch_add(device, &batches[2], xpy, xpy, ymy) && qp_internal_span_batch_add(device, &batches[3], xmy, xmy, ymy);
+    }
+    return qp_internal_span_batch_add(device, &batches[0], xpx, xpx, ypy) && qp_internal_span_batch_add(device, &batches[1], xmx, xmx, ypy) && qp_internal_span_batch_add(device, &batches[2], xpx, xpx, ymy) && qp_internal_span_batch_add(device, &batches[3], xmx, xmx, ymy) && qp_internal_span_batch_add(device, &batches[4], xpy, xpy, ypx) && qp_internal_span_batch_add(device, &batches[5], xmy, xmy, ypx) && qp_internal_span_batch_add(device, &batches[6], xpy, xpy, ymx) && qp_internal_span_batch_add(device, &batches[7], xmy, xmy, ymx);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,15 +81,18 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
     int16_t ycalc = (int16_t)radius;
     int16_t err   = ((5 - (radius >> 2)) >> 2);
 
-    qp_internal_fill_pixdata(device, (radius * 2) + 1, hue, sat, val);
+    // Filled circles batch lines into rectangles up to the full diameter wide, outlines only need runs along an octant
+    qp_internal_fill_pixdata(device, filled ? ((uint32_t)radius * 2 + 1) * (radius + 1) : radius + 1, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_circle: fail (could not start comms)\n");
         return false;
     }
 
+    qp_internal_span_batch_t batches[8] = {0};
+
     bool ret = true;
-    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+    if (!qp_circle_helper_impl(device, batches, x, y, xcalc, ycalc, filled)) {
         ret = false;
     }
 
@@ -159,14 +105,121 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
                 ycalc--;
                 err += ((xcalc - ycalc) << 1) + 1;
             }
-            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+            if (!qp_circle_helper_impl(device, batches, x, y, xcalc, ycalc, filled)) {
                 ret = false;
                 break;
             }
         }
     }
 
+    for (uint8_t i = 0; ret && i < ARRAY_SIZE(batches); ++i) {
+        ret = qp_internal_span_batch_flush(device, &batches[i]);
+    }
+
     qp_dprintf("qp_circle: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_circle_aa
+
+static uint16_t qp_circle_isqrt(uint32_t value) {
+    uint32_t result = 0;
+    uint32_t bit    = 1UL << 30;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+// Draws a run of samples from the first octant into all eight octants
+static bool qp_circle_aa_octants(painter_device_t device, qp_internal_aa_band_t *band, uint16_t centerx, uint16_t centery, uint16_t startx, uint16_t offsety, bool has_far) {
+    const struct {
+        bool   vertical;
+        int8_t sign_major;
+        int8_t sign_minor;
+    } octants[] = {
+        {false, 1, 1}, {false, -1, 1}, {false, 1, -1}, {false, -1, -1}, {true, 1, 1}, {true, -1, 1}, {true, 1, -1}, {true, -1, -1},
+    };
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(octants); ++i) {
+        uint16_t center_major = octants[i].vertical ? centery : centerx;
+        uint16_t center_minor = octants[i].vertical ? centerx : centery;
+        band->vertical        = octants[i].vertical;
+        band->reversed        = octants[i].sign_major < 0;
+        band->major           = band->reversed ? center_major - startx - (band->length - 1) : center_major + startx;
+        band->minor           = center_minor + octants[i].sign_minor * offsety;
+        band->far_step        = has_far ? octants[i].sign_minor : 0;
+        if (!qp_internal_aa_band_draw(device, band)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool qp_circle_aa(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_dprintf("qp_circle_aa: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_circle_aa: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    // The squared radius is kept in 24.8 fixed point
+    if (radius == 0 || radius > 4095) {
+        qp_dprintf("qp_circle_aa: fail (radius out of range)\n");
+        return false;
+    }
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_circle_aa: fail (could not start comms)\n");
+        return false;
+    }
+
+    /*
+    Samples are taken along the first octant, where the circle edge moves by
+    at most one row per column. Each column gets a pair of pixels straddling
+    the exact edge, weighted by how close the edge is to each. Columns with
+    the same pair of rows are gathered into a band and mirrored into every
+    octant, so that each band is a single transfer.
+    */
+    qp_internal_aa_band_t band    = {0};
+    uint16_t              startx  = 0;
+    uint16_t              offsety = radius;
+    uint32_t              max_run = MIN(QP_INTERNAL_AA_MAX_RUN, qp_internal_num_pixels_in_buffer(device) / 2);
+
+    bool ret = qp_internal_aa_prepare_palette(device, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg);
+    for (uint16_t offsetx = 0; ret; ++offsetx) {
+        uint16_t edge  = qp_circle_isqrt(((uint32_t)radius * radius - (uint32_t)offsetx * offsetx) << 8); // 12.4 fixed point
+        uint16_t row   = edge >> 4;
+        bool     done  = offsetx > row;
+        bool     flush = band.length > 0 && (done || row != offsety || band.length == max_run);
+        if (flush) {
+            // The outermost row is exact, and has no partially covered neighbour outside the circle
+            ret         = qp_circle_aa_octants(device, &band, x, y, startx, offsety, offsety < radius);
+            band.length = 0;
+        }
+        if (done) {
+            break;
+        }
+        if (band.length == 0) {
+            startx  = offsetx;
+            offsety = row;
+        }
+        band.levels[band.length++] = (QP_INTERNAL_AA_LEVELS - 1) - (edge & 0x0F);
+    }
+
+    qp_dprintf("qp_circle_aa: %s\n", ret ? "ok" : "fail");
+    qp_comms_stop(device);
+    return ret;
+}
@@ -5,6 +5,7 @@
 #include "qp_internal.h"
 #include "qp_draw.h"
 #include "qp_comms.h"
+#include "qgf.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Palette / Monochrome-format decoder
@@ -55,12 +56,9 @@ bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count,
 }
 
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg) {
-    painter_driver_t* driver = (painter_driver_t*)device;
-    int16_t           steps  = 1 << bits_per_pixel; // number of items we need to interpolate
-    if (qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, steps)) {
-        if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
-            return false;
-        }
+    int16_t steps = 1 << bits_per_pixel; // number of items we need to interpolate
+    if (!qp_internal_prepare_palette(device, fg_hsv888, bg_hsv888, steps)) {
+        return false;
     }
 
     return qp_internal_decode_palette(device, pixel_count, bits_per_pixel, input_callback, input_arg, qp_internal_global_pixel_lookup_table, output_callback, output_arg);
@@ -126,6 +124,76 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+#if QUANTUM_PAINTER_SUPPORTS_LZ
+// Window of the most recently decoded bytes, referenced by matches. Only one image is ever decoded at a time.
+static uint8_t qp_lz_window[QGF_LZ_WINDOW_SIZE];
+
+// Lengths of 15 are extended by each following byte, until one is not 255
+static inline uint32_t qp_lz_read_length(qp_stream_t* stream, uint32_t length) {
+    if (length == 15) {
+        int16_t c;
+        do {
+            c = qp_stream_get(stream);
+            if (c < 0) {
+                break;
+            }
+            length += c;
+        } while (c == 255);
+    }
+    return length;
+}
+
+static inline int16_t qp_drawimage_byte_lz_decoder(void* cb_arg) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
+
+    // Parse sequence headers until there's something to output
+    while (state->lz.literal_remain == 0 && state->lz.match_remain == 0) {
+        if (state->lz.mode == LZ_TOKEN) {
+            int16_t token = qp_stream_get(state->src_stream);
+            if (token < 0) {
+                return -1;
+            }
+            state->lz.token          = token;
+            state->lz.literal_remain = qp_lz_read_length(state->src_stream, state->lz.token >> 4);
+            state->lz.mode           = LZ_MATCH;
+        } else {
+            // Literals are done, so the match follows
+            int16_t lo = qp_stream_get(state->src_stream);
+            int16_t hi = qp_stream_get(state->src_stream);
+            if (lo < 0 || hi < 0) {
+                return -1;
+            }
+            state->lz.offset = (uint16_t)lo | ((uint16_t)hi << 8);
+            // Matches can't reach back beyond the window, nor before the start of this image's data
+            if (state->lz.offset == 0 || state->lz.offset > QGF_LZ_WINDOW_SIZE || state->lz.offset > state->lz.window_pos) {
+                qp_dprintf("qp_drawimage_byte_lz_decoder: invalid match offset %d\n", (int)state->lz.offset);
+                return -1;
+            }
+            state->lz.match_remain = qp_lz_read_length(state->src_stream, state->lz.token & 0x0F) + QGF_LZ_MIN_MATCH;
+            state->lz.mode         = LZ_TOKEN;
+        }
+    }
+
+    uint8_t c;
+    if (state->lz.literal_remain > 0) {
+        int16_t byteval = qp_stream_get(state->src_stream);
+        if (byteval < 0) {
+            return -1;
+        }
+        c = byteval;
+        state->lz.literal_remain--;
+    } else {
+        c = qp_lz_window[(state->lz.window_pos - state->lz.offset) & (QGF_LZ_WINDOW_SIZE - 1)];
+        state->lz.match_remain--;
+    }
+
+    qp_lz_window[state->lz.window_pos & (QGF_LZ_WINDOW_SIZE - 1)] = c;
+    state->lz.window_pos++;
+    state->curr = c;
+    return c;
+}
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
@@ -165,7 +233,97 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     return true;
 }
 
-// Helper shared between image and font rendering -- uses either (qp_internal_decode_palette + qp_internal_pixel_appender) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Bulk palette decoder
+
+// Number of pixels unpacked at a time by the bulk decoder
+#ifndef QP_BULK_DECODE_PIXELS
+#    define QP_BULK_DECODE_PIXELS 64
+#endif
+
+// Reads the next run of packed input bytes, straight from the stream if the input isn't compressed
+static inline bool qp_internal_read_input_bytes(qp_internal_byte_input_callback input_callback, void* input_arg, uint8_t* bytes, uint16_t byte_count) {
+    if (input_callback == qp_drawimage_byte_uncompressed_decoder) {
+        qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)input_arg;
+        return qp_stream_read(bytes, 1, byte_count, state->src_stream) == byte_count;
+    }
+
+    for (uint16_t i = 0; i < byte_count; ++i) {
+        int16_t byteval = input_callback(input_arg);
+        if (byteval < 0) {
+            return false;
+        }
+        bytes[i] = byteval;
+    }
+    return true;
+}
+
+// Expands packed palette indices, least-significant bits first, into one index per byte
+static inline void qp_internal_unpack_indices(uint8_t* indices, const uint8_t* bytes, uint16_t pixel_count, uint8_t bits_per_pixel) {
+    switch (bits_per_pixel) {
+        case 1:
+            for (uint16_t i = 0; i < pixel_count; ++i) {
+                indices[i] = (bytes[i >> 3] >> (i & 7)) & 0x01;
+            }
+            break;
+        case 2:
+            for (uint16_t i = 0; i < pixel_count; ++i) {
+                indices[i] = (bytes[i >> 2] >> ((i & 3) << 1)) & 0x03;
+            }
+            break;
+        case 4:
+            for (uint16_t i = 0; i < pixel_count; ++i) {
+                indices[i] = (bytes[i >> 1] >> ((i & 1) << 2)) & 0x0F;
+            }
+            break;
+        default:
+            memcpy(indices, bytes, pixel_count);
+            break;
+    }
+}
+
+// Equivalent to qp_internal_decode_palette + qp_internal_pixel_appender, but hands runs of pixels to the driver at once
+static bool qp_internal_decode_palette_bulk(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette) {
+    painter_driver_t* driver          = (painter_driver_t*)device;
+    const uint8_t     pixels_per_byte = 8 / bits_per_pixel;
+    const uint32_t    max_pixels      = qp_internal_num_pixels_in_buffer(device);
+    uint32_t          pixel_write_pos = 0;
+    uint8_t           bytes[QP_BULK_DECODE_PIXELS];
+    uint8_t           indices[QP_BULK_DECODE_PIXELS];
+
+    while (pixel_count > 0) {
+        // Whole input bytes only, bounded by the space left in the pixdata buffer
+        uint32_t loop_pixels = MIN(MIN(QP_BULK_DECODE_PIXELS, max_pixels - pixel_write_pos), pixel_count);
+        if (loop_pixels < pixel_count) {
+            loop_pixels -= loop_pixels % pixels_per_byte;
+        }
+
+        if (loop_pixels > 0) {
+            uint16_t byte_count = (loop_pixels + pixels_per_byte - 1) / pixels_per_byte;
+            if (!qp_internal_read_input_bytes(input_callback, input_arg, bytes, byte_count)) {
+                return false;
+            }
+            qp_internal_unpack_indices(indices, bytes, loop_pixels, bits_per_pixel);
+
+            if (!driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, palette, pixel_write_pos, loop_pixels, indices)) {
+                return false;
+            }
+            pixel_write_pos += loop_pixels;
+            pixel_count -= loop_pixels;
+        }
+
+        // If the buffer can't fit another input byte's worth of pixels, or we've run out of pixels, send it out and reset the write position
+        if (loop_pixels == 0 || pixel_write_pos == max_pixels || pixel_count == 0) {
+            if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, pixel_write_pos)) {
+                return false;
+            }
+            pixel_write_pos = 0;
+        }
+    }
+    return true;
+}
+
+// Helper shared between image and font rendering -- uses either (qp_internal_decode_palette_bulk) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
     painter_driver_t* driver = (painter_driver_t*)device;
 
@@ -173,15 +331,8 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
 
     // Non-native pixel format
     if (bpp <= 8) {
-        // Set up the output state
-        qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
-
         // Decode the pixel data and stream to the display
-        ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
-        // Any leftovers need transmission as well.
-        if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
-        }
+        ret = qp_internal_decode_palette_bulk(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table);
     }
 
     // Native pixel format
@@ -212,6 +363,14 @@ qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte
             input_state->rle.mode   = MARKER_BYTE;
             input_state->rle.remain = 0;
             return qp_drawimage_byte_rle_decoder;
+#if QUANTUM_PAINTER_SUPPORTS_LZ
+        case IMAGE_COMPRESSED_LZ:
+            input_state->lz.mode           = LZ_TOKEN;
+            input_state->lz.window_pos     = 0;
+            input_state->lz.literal_remain = 0;
+            input_state->lz.match_remain   = 0;
+            return qp_drawimage_byte_lz_decoder;
+#endif // QUANTUM_PAINTER_SUPPORTS_LZ
         default:
             return NULL;
     }
@@ -21,11 +21,20 @@ STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXD
 //
 
 // Buffer used for transmitting native pixel data to the downstream device.
+#if QUANTUM_PAINTER_SPI_ASYNC
+__attribute__((__aligned__(4))) static uint8_t qp_internal_pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t                                       *qp_internal_global_pixdata_buffer = qp_internal_pixdata_buffers[0];
+const void                                    *qp_internal_async_pixdata_source  = NULL;
+static uint32_t                                qp_internal_pixdata_fill_bytes    = 0;     // bytes written by the last qp_internal_fill_pixdata()
+static bool                                    qp_internal_pixdata_fill_copied   = false; // whether both halves already hold them
+#else
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
 static int16_t                                    generated_steps   = -1;
+static painter_device_t                           generated_device  = NULL; // device the palette was converted for, if any
 __attribute__((__aligned__(4))) static qp_pixel_t interpolated_fg_hsv888;
 __attribute__((__aligned__(4))) static qp_pixel_t interpolated_bg_hsv888;
 #if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
@@ -42,6 +51,19 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+#if QUANTUM_PAINTER_SPI_ASYNC
+// Solid fills are written once and then sent many times, so the filled bytes are carried across to the other half -- only
+// once per fill, as neither half is written to again until the next fill. Everything else rewrites the buffer before each send.
+void qp_internal_swap_pixdata_buffer(void) {
+    uint8_t *next = (qp_internal_global_pixdata_buffer == qp_internal_pixdata_buffers[0]) ? qp_internal_pixdata_buffers[1] : qp_internal_pixdata_buffers[0];
+    if (!qp_internal_pixdata_fill_copied) {
+        memcpy(next, qp_internal_global_pixdata_buffer, qp_internal_pixdata_fill_bytes);
+        qp_internal_pixdata_fill_copied = true;
+    }
+    qp_internal_global_pixdata_buffer = next;
+}
+#endif // QUANTUM_PAINTER_SPI_ASYNC
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -58,17 +80,35 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     qp_pixel_t color = {.hsv888 = {.h = hue, .s = sat, .v = val}};
     driver->driver_vtable->palette_convert(device, 1, &color);
 
-    // Append the required number of pixels
-    uint8_t palette_idx = 0;
-    for (uint32_t i = 0; i < num_pixels; ++i) {
+    // Append enough pixels to make up whole bytes, which can then be repeated for the rest of the buffer
+    uint8_t  bpp          = driver->native_bits_per_pixel;
+    bool     repeatable   = bpp < 8 ? (8 % bpp) == 0 : (bpp % 8) == 0;
+    uint32_t first_pixels = !repeatable ? num_pixels : MIN(num_pixels, bpp < 8 ? 8u / bpp : 1u);
+    uint8_t  palette_idx  = 0;
+    for (uint32_t i = 0; i < first_pixels; ++i) {
         driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, i, 1, &palette_idx);
     }
+
+    // Doubling the filled area each time keeps the number of copies down to a handful
+    uint32_t filled_bytes = (first_pixels * bpp) / 8;
+    uint32_t total_bytes  = (num_pixels * bpp + 7) / 8;
+    while (first_pixels < num_pixels && filled_bytes < total_bytes) {
+        uint32_t copy_bytes = MIN(filled_bytes, total_bytes - filled_bytes);
+        memcpy(&qp_internal_global_pixdata_buffer[filled_bytes], qp_internal_global_pixdata_buffer, copy_bytes);
+        filled_bytes += copy_bytes;
+    }
+
+#if QUANTUM_PAINTER_SPI_ASYNC
+    qp_internal_pixdata_fill_bytes  = total_bytes;
+    qp_internal_pixdata_fill_copied = false;
+#endif // QUANTUM_PAINTER_SPI_ASYNC
 }
 
 // Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
 void qp_internal_invalidate_palette(void) {
     generated_palette = false;
     generated_steps   = -1;
+    generated_device  = NULL;
 }
 
 // Interpolates between two colors to generate a palette
@@ -83,6 +123,7 @@ bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888,
     // Save the parameters so we know whether we can skip generation
     generated_palette      = true;
     generated_steps        = steps;
+    generated_device       = NULL;
     interpolated_fg_hsv888 = fg_hsv888;
     interpolated_bg_hsv888 = bg_hsv888;
 
@@ -108,6 +149,111 @@ bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888,
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Palette cache
+
+static qp_palette_cache_stats_t qp_palette_cache_stats;
+
+#if QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+// Larger palettes are converted every time, they would take too much RAM to keep around
+#    define QP_PALETTE_CACHE_MAX_STEPS 16
+
+typedef struct qp_palette_cache_entry_t {
+    painter_device_t device; // NULL if unused
+    hsv_t            fg;
+    hsv_t            bg;
+    int16_t          steps;
+    uint16_t         last_used;
+    qp_pixel_t       palette[QP_PALETTE_CACHE_MAX_STEPS];
+} qp_palette_cache_entry_t;
+
+static qp_palette_cache_entry_t qp_palette_cache_entries[QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES];
+static uint16_t                 qp_palette_cache_clock = 0;
+
+static inline bool qp_palette_cache_matches(const qp_palette_cache_entry_t *entry, painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    return entry->device == device && entry->steps == steps && memcmp(&entry->fg, &fg_hsv888.hsv888, sizeof(hsv_t)) == 0 && memcmp(&entry->bg, &bg_hsv888.hsv888, sizeof(hsv_t)) == 0;
+}
+
+// Picks an unused entry, or the least-recently-used one
+static qp_palette_cache_entry_t *qp_palette_cache_victim(void) {
+    qp_palette_cache_entry_t *lru = &qp_palette_cache_entries[0];
+    for (int i = 0; i < QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES; ++i) {
+        qp_palette_cache_entry_t *entry = &qp_palette_cache_entries[i];
+        if (!entry->device) {
+            return entry;
+        }
+        if ((uint16_t)(qp_palette_cache_clock - entry->last_used) > (uint16_t)(qp_palette_cache_clock - lru->last_used)) {
+            lru = entry;
+        }
+    }
+    return lru;
+}
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+
+const qp_palette_cache_stats_t *qp_internal_palette_cache_get_stats(void) {
+    return &qp_palette_cache_stats;
+}
+
+void qp_internal_palette_cache_clear(void) {
+#if QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+    memset(qp_palette_cache_entries, 0, sizeof(qp_palette_cache_entries));
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+    memset(&qp_palette_cache_stats, 0, sizeof(qp_palette_cache_stats));
+    qp_internal_invalidate_palette();
+}
+
+// Sets up the global palette with the native equivalent of the interpolation between two colors
+bool qp_internal_prepare_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    // The lookup table may already hold exactly this palette
+    if (generated_palette && generated_device == device && generated_steps == steps && memcmp(&interpolated_fg_hsv888.hsv888, &fg_hsv888.hsv888, sizeof(hsv_t)) == 0 && memcmp(&interpolated_bg_hsv888.hsv888, &bg_hsv888.hsv888, sizeof(hsv_t)) == 0) {
+        qp_palette_cache_stats.hits++;
+        return true;
+    }
+
+#if QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+    for (int i = 0; i < QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES; ++i) {
+        qp_palette_cache_entry_t *entry = &qp_palette_cache_entries[i];
+        if (qp_palette_cache_matches(entry, device, fg_hsv888, bg_hsv888, steps)) {
+            entry->last_used = ++qp_palette_cache_clock;
+            memcpy(qp_internal_global_pixel_lookup_table, entry->palette, steps * sizeof(qp_pixel_t));
+            generated_palette      = true;
+            generated_steps        = steps;
+            generated_device       = device;
+            interpolated_fg_hsv888 = fg_hsv888;
+            interpolated_bg_hsv888 = bg_hsv888;
+            qp_palette_cache_stats.hits++;
+            return true;
+        }
+    }
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+
+    // Regenerate from scratch, as the lookup table may hold the same colors converted for another device
+    qp_palette_cache_stats.misses++;
+    qp_internal_invalidate_palette();
+    qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, steps);
+    if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
+        qp_internal_invalidate_palette();
+        return false;
+    }
+    generated_device = device;
+
+#if QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+    if (steps <= QP_PALETTE_CACHE_MAX_STEPS) {
+        qp_palette_cache_entry_t *entry = qp_palette_cache_victim();
+        entry->device                   = device;
+        entry->fg                       = fg_hsv888.hsv888;
+        entry->bg                       = bg_hsv888.hsv888;
+        entry->steps                    = steps;
+        entry->last_used                = ++qp_palette_cache_clock;
+        memcpy(entry->palette, qp_internal_global_pixel_lookup_table, steps * sizeof(qp_pixel_t));
+    }
+#endif // QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES > 0
+
+    return true;
+}
+
 // Helper shared between image and font rendering -- sets up the global palette to match the palette block specified in the asset. Expects the stream to be positioned at the start of the block header.
 bool qp_internal_load_qgf_palette(qp_stream_t *stream, uint8_t bpp) {
     qgf_palette_v1_t palette_descriptor;
@@ -181,13 +327,6 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
         return false;
     }
 
-    if (!qp_comms_start(device)) {
-        qp_dprintf("Failed to start comms in qp_line\n");
-        return false;
-    }
-
-    qp_internal_fill_pixdata(device, 1, hue, sat, val);
-
     // draw angled line using Bresenham's algo
     int16_t x      = ((int16_t)x0);
     int16_t y      = ((int16_t)y0);
@@ -199,9 +338,19 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
     int16_t e  = dx + dy;
     int16_t e2 = 2 * e;
 
+    if (!qp_comms_start(device)) {
+        qp_dprintf("Failed to start comms in qp_line\n");
+        return false;
+    }
+
+    // Pixels are batched into horizontal or vertical runs, the longest of which is as long as the major axis
+    qp_internal_fill_pixdata(device, MAX(dx, -dy) + 1, hue, sat, val);
+
+    qp_internal_span_batch_t batch = {0};
+
     bool ret = true;
     while (x != x1 || y != y1) {
-        if (!qp_internal_setpixel_impl(device, x, y)) {
+        if (!qp_internal_span_batch_add(device, &batch, x, x, y)) {
             ret = false;
             break;
         }
@@ -216,7 +365,7 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
         }
     }
     // draw the last pixel
-    if (!qp_internal_setpixel_impl(device, x, y)) {
+    if (ret && (!qp_internal_span_batch_add(device, &batch, x, x, y) || !qp_internal_span_batch_flush(device, &batch))) {
         ret = false;
     }
 
@@ -225,6 +374,73 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
     return ret;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_line_aa
+
+bool qp_line_aa(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    int16_t dx = abs(((int16_t)x1) - ((int16_t)x0));
+    int16_t dy = abs(((int16_t)y1) - ((int16_t)y0));
+    if (dx == 0 || dy == 0 || dx == dy) {
+        // Axis-aligned and diagonal lines have no partially covered pixels
+        return qp_line(device, x0, y0, x1, y1, hue_fg, sat_fg, val_fg);
+    }
+
+    qp_dprintf("qp_line_aa(%d, %d, %d, %d): entry\n", (int)x0, (int)y0, (int)x1, (int)y1);
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_line_aa: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    // Walk along the major axis from its lower end, tracking the minor axis position in 16.16 fixed point
+    qp_internal_aa_band_t band = {.vertical = dy > dx};
+    uint16_t              a0   = band.vertical ? y0 : x0;
+    uint16_t              a1   = band.vertical ? y1 : x1;
+    uint16_t              b0   = band.vertical ? x0 : y0;
+    uint16_t              b1   = band.vertical ? x1 : y1;
+    if (a0 > a1) {
+        uint16_t temp;
+        temp = a0;
+        a0   = a1;
+        a1   = temp;
+        temp = b0;
+        b0   = b1;
+        b1   = temp;
+    }
+    int32_t  gradient = (((int32_t)b1 - (int32_t)b0) * 65536) / (a1 - a0);
+    int32_t  pos      = ((int32_t)b0) << 16;
+    uint16_t bmax     = MAX(b0, b1);
+    uint32_t max_run  = MIN(QP_INTERNAL_AA_MAX_RUN, qp_internal_num_pixels_in_buffer(device) / 2);
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_line_aa: fail (could not start comms)\n");
+        return false;
+    }
+
+    bool ret = qp_internal_aa_prepare_palette(device, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg);
+    for (uint16_t a = a0; ret && a <= a1; ++a, pos += gradient) {
+        uint16_t minor = pos >> 16;
+        uint8_t  frac  = (pos >> 12) & 0x0F;
+        if (band.length > 0 && (minor != band.minor || band.length == max_run)) {
+            ret         = qp_internal_aa_band_draw(device, &band);
+            band.length = 0;
+        }
+        if (band.length == 0) {
+            band.major    = a;
+            band.minor    = minor;
+            band.far_step = minor < bmax ? 1 : 0; // never spill outside the line's bounding box
+        }
+        band.levels[band.length++] = (QP_INTERNAL_AA_LEVELS - 1) - frac;
+    }
+    if (ret && band.length > 0) {
+        ret = qp_internal_aa_band_draw(device, &band);
+    }
+
+    qp_comms_stop(device);
+    qp_dprintf("qp_line_aa(%d, %d, %d, %d): %s\n", (int)x0, (int)y0, (int)x1, (int)y1, ret ? "ok" : "fail");
+    return ret;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_rect
 
@@ -251,6 +467,76 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
     return true;
 }
 
+bool qp_internal_span_batch_flush(painter_device_t device, qp_internal_span_batch_t *batch) {
+    if (!batch->active) {
+        return true;
+    }
+    batch->active = false;
+    return qp_internal_fillrect_helper_impl(device, batch->l, batch->t, batch->r, batch->b);
+}
+
+bool qp_internal_span_batch_add(painter_device_t device, qp_internal_span_batch_t *batch, uint16_t l, uint16_t r, uint16_t y) {
+    if (batch->active) {
+        // Overlapping or touching span on the same row
+        if (batch->t == y && batch->b == y && l <= batch->r + 1 && r + 1 >= batch->l) {
+            batch->l = MIN(batch->l, l);
+            batch->r = MAX(batch->r, r);
+            return true;
+        }
+
+        // Identical span on an adjacent row
+        if (batch->l == l && batch->r == r && (y == batch->b + 1 || y + 1 == batch->t)) {
+            batch->t = MIN(batch->t, y);
+            batch->b = MAX(batch->b, y);
+            return true;
+        }
+
+        if (!qp_internal_span_batch_flush(device, batch)) {
+            return false;
+        }
+    }
+
+    batch->active = true;
+    batch->l      = l;
+    batch->t      = y;
+    batch->r      = r;
+    batch->b      = y;
+    return true;
+}
+
+bool qp_internal_aa_prepare_palette(painter_device_t device, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_pixel_t fg = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    return qp_internal_prepare_palette(device, fg, bg, QP_INTERNAL_AA_LEVELS);
+}
+
+bool qp_internal_aa_band_draw(painter_device_t device, const qp_internal_aa_band_t *band) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    uint16_t major_end = band->major + band->length - 1;
+    uint16_t minor_lo  = band->far_step < 0 ? band->minor - 1 : band->minor;
+    uint16_t minor_hi  = band->far_step > 0 ? band->minor + 1 : band->minor;
+    uint16_t l         = band->vertical ? minor_lo : band->major;
+    uint16_t t         = band->vertical ? band->major : minor_lo;
+    uint16_t r         = band->vertical ? minor_hi : major_end;
+    uint16_t b         = band->vertical ? major_end : minor_hi;
+
+    // Native pixels are laid out in the order the panel expects them, i.e. left to right, top to bottom
+    uint32_t pixel = 0;
+    for (uint16_t y = t; y <= b; ++y) {
+        for (uint16_t x = l; x <= r; ++x) {
+            uint16_t along = (band->vertical ? y : x) - band->major;
+            uint8_t  level = band->levels[band->reversed ? band->length - 1 - along : along];
+            if ((band->vertical ? x : y) != band->minor) {
+                level = (QP_INTERNAL_AA_LEVELS - 1) - level;
+            }
+            driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, pixel++, 1, &level);
+        }
+    }
+
+    return driver->driver_vtable->viewport(device, l, t, r, b) && driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, pixel);
+}
+
 bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
     qp_dprintf("qp_rect(%d, %d, %d, %d): entry\n", (int)left, (int)top, (int)right, (int)bottom);
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -7,7 +7,7 @@
 #include "qp_draw.h"
 
 // Utilize 4-way symmetry to draw an ellipse
-static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+static bool qp_ellipse_helper_impl(painter_device_t device, qp_internal_span_batch_t *batches, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
     /*
     Ellipses have the property of 4-way symmetry, so four pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
@@ -16,44 +16,30 @@ static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, ui
     For filled ellipses, we can draw horizontal lines between each pair of
     pixels with the same final value of y.
 
+    Each of the symmetric points (or lines) is fed to its own batch, which
+    coalesces them into runs along a row or column, or into rectangles.
+
     When offsetx == 0 only two pixels can be drawn for filled or unfilled ellipses
     */
 
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
+    uint16_t xpx = centerx + offsetx;
+    uint16_t xmx = centerx - offsetx;
+    uint16_t ypy = centery + offsety;
+    uint16_t ymy = centery - offsety;
 
     if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
+        return qp_internal_span_batch_add(device, &batches[0], xpx, xpx, ypy) && qp_internal_span_batch_add(device, &batches[2], xpx, xpx, ymy);
     } else if (filled) {
-        if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-            return false;
-        }
-        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-            return false;
-        }
-    } else {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
+        if (!qp_internal_span_batch_add(device, &batches[0], xmx, xpx, ypy)) {
             return false;
         }
-        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
+        if (offsety > 0 && !qp_internal_span_batch_add(device, &batches[2], xmx, xpx, ymy)) {
             return false;
         }
+        return true;
     }
 
-    return true;
+    return qp_internal_span_batch_add(device, &batches[0], xpx, xpx, ypy) && qp_internal_span_batch_add(device, &batches[1], xmx, xmx, ypy) && qp_internal_span_batch_add(device, &batches[2], xpx, xpx, ymy) && qp_internal_span_batch_add(device, &batches[3], xmx, xmx, ymy);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,16 +61,19 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     int16_t dx = 0;
     int16_t dy = ((int16_t)sizey);
 
-    qp_internal_fill_pixdata(device, MAX(sizex, sizey), hue, sat, val);
+    // Filled ellipses batch lines into rectangles up to the full width wide, outlines only need runs along a quadrant
+    qp_internal_fill_pixdata(device, filled ? ((uint32_t)sizex * 2 + 1) * (sizey + 1) : MAX(sizex, sizey) + 1, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_ellipse: fail (could not start comms)\n");
         return false;
     }
 
+    qp_internal_span_batch_t batches[4] = {0};
+
     bool ret = true;
     for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
+        if (!qp_ellipse_helper_impl(device, batches, x, y, dx, dy, filled)) {
             ret = false;
             break;
         }
@@ -99,7 +88,7 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     dy = 0;
 
     for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
+        if (!qp_ellipse_helper_impl(device, batches, x, y, dx, dy, filled)) {
             ret = false;
             break;
         }
@@ -110,6 +99,10 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
         delta += aa * (4 * dy + 6);
     }
 
+    for (uint8_t i = 0; ret && i < ARRAY_SIZE(batches); ++i) {
+        ret = qp_internal_span_batch_flush(device, &batches[i]);
+    }
+
     qp_dprintf("qp_ellipse: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
@@ -27,6 +27,9 @@ typedef struct qff_font_handle_t {
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
     };
 #if QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
     bool  owns_buffer;
@@ -36,6 +39,197 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph rendering into RAM, used by the glyph cache and text runs
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0 || QUANTUM_PAINTER_NUM_TEXT_RUNS > 0
+
+// Number of bytes required to hold the supplied number of pixels in the device's native format
+static inline uint32_t qp_drawtext_native_bytes(painter_device_t device, uint32_t pixel_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    return (pixel_count * driver->native_bits_per_pixel + 7) / 8;
+}
+
+// Pixel output state, placing each decoded glyph pixel at its location within a wider native pixel buffer
+typedef struct qp_drawtext_buffer_output_state_t {
+    painter_device_t device;
+    uint8_t         *buffer;
+    uint16_t         stride;
+    uint16_t         xpos;
+    uint8_t          width;
+    uint32_t         pixel_pos;
+} qp_drawtext_buffer_output_state_t;
+
+static bool qp_drawtext_buffer_pixel_appender(qp_pixel_t *palette, uint8_t index, void *cb_arg) {
+    qp_drawtext_buffer_output_state_t *state  = (qp_drawtext_buffer_output_state_t *)cb_arg;
+    painter_driver_t                  *driver = (painter_driver_t *)state->device;
+
+    uint32_t offset = (state->pixel_pos / state->width) * state->stride + state->xpos + (state->pixel_pos % state->width);
+    state->pixel_pos++;
+    return driver->driver_vtable->append_pixels(state->device, state->buffer, palette, offset, 1, &index);
+}
+
+// Decodes the glyph the stream is currently positioned at into native pixels, at the given x-offset of a buffer `stride` pixels wide
+static bool qp_drawtext_render_glyph(painter_device_t device, qff_font_handle_t *qff_font, uint8_t width, qp_internal_byte_input_callback input_callback, qp_internal_byte_input_state_t *input_state, uint8_t *buffer, uint16_t stride, uint16_t xpos) {
+    painter_driver_t *driver      = (painter_driver_t *)device;
+    uint32_t          pixel_count = ((uint32_t)width) * qff_font->base.line_height;
+
+    // Reset the input state's RLE mode -- the stream should already be correctly positioned
+    input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
+
+    // Non-native pixel format
+    if (qff_font->bpp <= 8) {
+        qp_drawtext_buffer_output_state_t output_state = {.device = device, .buffer = buffer, .stride = stride, .xpos = xpos, .width = width, .pixel_pos = 0};
+        return qp_internal_decode_palette(device, pixel_count, qff_font->bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_drawtext_buffer_pixel_appender, &output_state);
+    }
+
+    // Native pixel format
+    if (qff_font->bpp != driver->native_bits_per_pixel) {
+        qp_dprintf("Font's bpp (%d) doesn't match the target display's native_bits_per_pixel (%d)\n", qff_font->bpp, driver->native_bits_per_pixel);
+        return false;
+    }
+
+    uint8_t bytes_per_pixel = qff_font->bpp / 8;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        uint32_t offset = ((i / width) * stride + xpos + (i % width)) * bytes_per_pixel;
+        for (uint8_t j = 0; j < bytes_per_pixel; ++j) {
+            int16_t byteval = input_callback(input_state);
+            if (byteval < 0 || !driver->driver_vtable->append_pixdata(device, buffer, offset + j, byteval)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0 || QUANTUM_PAINTER_NUM_TEXT_RUNS > 0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+// Cached glyphs are only valid for the device and colors they were decoded with, as they're stored in native format
+typedef struct qp_glyph_cache_entry_t {
+    painter_device_t         device;
+    const qff_font_handle_t *font;
+    uint32_t                 code_point;
+    qp_pixel_t               fg_hsv888;
+    qp_pixel_t               bg_hsv888;
+    uint16_t                 offset;    // location of the native pixel data within the pool
+    uint16_t                 length;    // number of bytes used in the pool, zero if this entry is free
+    uint16_t                 last_used; // value of the use counter when this glyph was last drawn
+    uint8_t                  width;
+} qp_glyph_cache_entry_t;
+
+__attribute__((__aligned__(4))) static uint8_t qp_glyph_cache_pool[QUANTUM_PAINTER_GLYPH_CACHE_SIZE];
+static qp_glyph_cache_entry_t                  qp_glyph_cache_entries[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES];
+static uint16_t                                qp_glyph_cache_end   = 0;
+static uint16_t                                qp_glyph_cache_clock = 0;
+
+static inline uint16_t qp_glyph_cache_age(const qp_glyph_cache_entry_t *entry) {
+    return qp_glyph_cache_clock - entry->last_used;
+}
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(painter_device_t device, const qff_font_handle_t *qff_font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &qp_glyph_cache_entries[i];
+        if (entry->length > 0 && entry->code_point == code_point && entry->font == qff_font && entry->device == device && entry->fg_hsv888.dummy == fg_hsv888.dummy && entry->bg_hsv888.dummy == bg_hsv888.dummy) {
+            entry->last_used = ++qp_glyph_cache_clock;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Moves all cached glyphs to the start of the pool, so that the space freed by evictions can be reused
+static void qp_glyph_cache_compact(void) {
+    uint16_t next = 0;
+    while (true) {
+        // Find the lowest glyph which hasn't yet been moved
+        qp_glyph_cache_entry_t *lowest = NULL;
+        for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+            qp_glyph_cache_entry_t *entry = &qp_glyph_cache_entries[i];
+            if (entry->length > 0 && entry->offset >= next && (!lowest || entry->offset < lowest->offset)) {
+                lowest = entry;
+            }
+        }
+        if (!lowest) {
+            break;
+        }
+
+        if (lowest->offset != next) {
+            memmove(&qp_glyph_cache_pool[next], &qp_glyph_cache_pool[lowest->offset], lowest->length);
+            lowest->offset = next;
+        }
+        next += lowest->length;
+    }
+    qp_glyph_cache_end = next;
+}
+
+// Reserves space for a glyph, evicting the least-recently-used glyphs as necessary. Returns NULL if the glyph can never fit.
+static qp_glyph_cache_entry_t *qp_glyph_cache_insert(painter_device_t device, const qff_font_handle_t *qff_font, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint8_t width) {
+    // Keep each glyph word-aligned, as drivers may read their native pixels in larger units
+    uint32_t length = (qp_drawtext_native_bytes(device, ((uint32_t)width) * qff_font->base.line_height) + 3) & ~3u;
+    if (length == 0 || length > QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+        return NULL;
+    }
+
+    qp_glyph_cache_entry_t *entry;
+    while (true) {
+        uint32_t                used = 0;
+        qp_glyph_cache_entry_t *lru  = NULL;
+        entry                        = NULL;
+        for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+            qp_glyph_cache_entry_t *candidate = &qp_glyph_cache_entries[i];
+            if (candidate->length == 0) {
+                if (!entry) {
+                    entry = candidate;
+                }
+            } else {
+                used += candidate->length;
+                if (!lru || qp_glyph_cache_age(candidate) > qp_glyph_cache_age(lru)) {
+                    lru = candidate;
+                }
+            }
+        }
+
+        if (entry && used + length <= QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+            break;
+        }
+
+        qp_dprintf("qp_glyph_cache: evicting U+%04X\n", (int)lru->code_point);
+        lru->length = 0;
+    }
+
+    if (qp_glyph_cache_end + length > QUANTUM_PAINTER_GLYPH_CACHE_SIZE) {
+        qp_glyph_cache_compact();
+    }
+
+    entry->device     = device;
+    entry->font       = qff_font;
+    entry->code_point = code_point;
+    entry->fg_hsv888  = fg_hsv888;
+    entry->bg_hsv888  = bg_hsv888;
+    entry->offset     = qp_glyph_cache_end;
+    entry->length     = length;
+    entry->last_used  = ++qp_glyph_cache_clock;
+    entry->width      = width;
+    qp_glyph_cache_end += length;
+    return entry;
+}
+
+// Drops all cached glyphs belonging to the supplied font
+static void qp_glyph_cache_invalidate_font(const qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (qp_glyph_cache_entries[i].font == qff_font) {
+            qp_glyph_cache_entries[i].length = 0;
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -73,21 +267,24 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
     font->owns_buffer = false;
     font->buffer      = NULL;
 
-    void *ram_buffer = malloc(font->mem_stream.length);
+    // Works for any stream type, so fonts in external flash can be moved into RAM too
+    uint32_t length     = qff_get_total_size(&font->stream);
+    void    *ram_buffer = malloc(length);
     if (ram_buffer == NULL) {
         qp_dprintf("qp_load_font: could not allocate enough RAM for font, falling back to original\n");
     } else {
         do {
             // Copy the data into RAM
-            if (qp_stream_read(ram_buffer, 1, font->mem_stream.length, &font->mem_stream) != font->mem_stream.length) {
+            if (qp_stream_setpos(&font->stream, 0) < 0 || qp_stream_read(ram_buffer, 1, length, &font->stream) != length) {
                 qp_dprintf("qp_load_font: could not copy from flash to RAM, falling back to original\n");
                 break;
             }
 
             // Create the new stream with the new buffer
+            qp_stream_close(&font->stream);
             font->buffer      = ram_buffer;
             font->owns_buffer = true;
-            font->mem_stream  = qp_make_memory_stream(font->buffer, font->mem_stream.length);
+            font->mem_stream  = qp_make_memory_stream(font->buffer, length);
         } while (0);
     }
 
@@ -132,6 +329,30 @@ painter_font_handle_t qp_load_font_mem(const void *buffer) {
     return qp_load_font_internal(font_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_font_flash
+
+static inline bool font_flash_stream_factory(qff_font_handle_t *font, void *arg) {
+    uint32_t address = *(uint32_t *)arg;
+
+    // Assume we can read the font descriptor
+    font->flash_stream = qp_make_flash_stream(address, sizeof(qff_font_descriptor_v1_t));
+
+    // Update the length of the stream to match, and rewind to the start
+    font->flash_stream.length   = qff_get_total_size(&font->stream);
+    font->flash_stream.position = 0;
+
+    return true;
+}
+
+painter_font_handle_t qp_load_font_flash(uint32_t address) {
+    return qp_load_font_internal(font_flash_stream_factory, &address);
+}
+
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_font
 
@@ -151,6 +372,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Any cached glyphs are now stale
+    qp_glyph_cache_invalidate_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -196,16 +422,17 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
         offset += sizeof(qgf_palette_v1_t) + (palette_entries * 3);
         needs_pixconvert = true;
     } else {
-        // Interpolate from fg/bg
-        int16_t palette_entries = 1 << qff_font->bpp;
-        needs_pixconvert        = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
+        // Interpolate from fg/bg, reusing an earlier conversion if possible
+        if (!qp_internal_prepare_palette(device, fg_hsv888, bg_hsv888, palette_entries)) {
+            qp_dprintf("qp_drawtext_recolor: fail (could not convert pixels to native)\n");
+            return false;
+        }
     }
 
     if (needs_pixconvert) {
         // Convert the palette to native format
         if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
             qp_dprintf("qp_drawtext_recolor: fail (could not convert pixels to native)\n");
-            qp_comms_stop(device);
             return false;
         }
     }
@@ -369,6 +596,70 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+// Draws each codepoint as a straight blit from the glyph cache, decoding and caching any glyphs not already present
+static bool qp_drawtext_cached_glyphs(qff_font_handle_t *qff_font, const char *str, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, code_point_iter_drawglyph_state_t *state) {
+    painter_driver_t *driver        = (painter_driver_t *)state->device;
+    uint8_t           height        = qff_font->base.line_height;
+    bool              palette_ready = false;
+
+    while (*str) {
+        int32_t code_point = 0;
+        str                = decode_utf8(str, &code_point);
+        if (code_point < 0) {
+            qp_dprintf("Invalid unicode code point decoded. Cannot render.\n");
+            return false;
+        }
+
+        qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(state->device, qff_font, code_point, fg_hsv888, bg_hsv888);
+        if (!entry) {
+            // Palette setup is only needed once something actually has to be decoded
+            if (!palette_ready) {
+                uint32_t data_offset;
+                if (!qp_drawtext_prepare_font_for_render(state->device, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
+                    qp_dprintf("Failed to prepare font for rendering.\n");
+                    return false;
+                }
+                palette_ready = true;
+            }
+
+            uint8_t width;
+            if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+                qp_dprintf("Failed to prepare glyph for rendering.\n");
+                return false;
+            }
+
+            entry = qp_glyph_cache_insert(state->device, qff_font, code_point, fg_hsv888, bg_hsv888, width);
+            if (!entry) {
+                // Glyph is too large to ever be cached, stream it directly instead
+                if (!qp_font_code_point_handler_drawglyph(qff_font, code_point, width, height, state)) {
+                    qp_dprintf("Failed to execute glyph handler.\n");
+                    return false;
+                }
+                continue;
+            }
+
+            if (!qp_drawtext_render_glyph(state->device, qff_font, width, state->input_callback, state->input_state, &qp_glyph_cache_pool[entry->offset], width, 0)) {
+                qp_dprintf("Failed to render glyph into the glyph cache.\n");
+                entry->length = 0;
+                return false;
+            }
+        }
+
+        if (!driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + entry->width - 1, state->ypos + height - 1) || !driver->driver_vtable->pixdata(state->device, &qp_glyph_cache_pool[entry->offset], ((uint32_t)entry->width) * height)) {
+            qp_dprintf("Failed to draw cached glyph.\n");
+            return false;
+        }
+
+        // Move the x-position for the next glyph
+        state->xpos += entry->width;
+    }
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_textwidth
 
@@ -441,7 +732,12 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 
     qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Blit each glyph from the cache, only preparing the font if a glyph needs decoding
+    bool ret = qp_drawtext_cached_glyphs(qff_font, str, fg_hsv888, bg_hsv888, &state);
+#else  // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    uint32_t data_offset;
     if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
         qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
         qp_comms_stop(device);
@@ -450,8 +746,175 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 
     // Iterate the codepoints with the drawglyph callback
     bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
 
     qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret ? (state.xpos - x) : 0;
 }
+
+#if QUANTUM_PAINTER_NUM_TEXT_RUNS > 0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Text runs
+
+typedef struct qp_text_run_t {
+    painter_text_run_desc_t base;
+    bool                    validate_ok;
+    painter_device_t        device;
+    uint8_t                *buffer;
+} qp_text_run_t;
+
+static qp_text_run_t text_run_descriptors[QUANTUM_PAINTER_NUM_TEXT_RUNS] = {0};
+
+// Callback state
+typedef struct code_point_iter_rendertorun_state_t {
+    painter_device_t                device;
+    qp_text_run_t                  *run;
+    uint16_t                        xpos;
+    qp_internal_byte_input_callback input_callback;
+    qp_internal_byte_input_state_t *input_state;
+} code_point_iter_rendertorun_state_t;
+
+// Codepoint handler callback: rendering into a text run
+static inline bool qp_font_code_point_handler_rendertorun(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
+    code_point_iter_rendertorun_state_t *state = (code_point_iter_rendertorun_state_t *)cb_arg;
+
+    if (!qp_drawtext_render_glyph(state->device, qff_font, width, state->input_callback, state->input_state, state->run->buffer, state->run->base.width, state->xpos)) {
+        return false;
+    }
+
+    // Move the x-position for the next glyph
+    state->xpos += width;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_make_text_run
+
+painter_text_run_handle_t qp_make_text_run(painter_device_t device, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_dprintf("qp_make_text_run: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_make_text_run: fail (validation_ok == false)\n");
+        return NULL;
+    }
+
+    qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
+    if (!qff_font || !qff_font->validate_ok) {
+        qp_dprintf("qp_make_text_run: fail (invalid font)\n");
+        return NULL;
+    }
+
+    // Find a free slot
+    qp_text_run_t *run = NULL;
+    for (int i = 0; i < QUANTUM_PAINTER_NUM_TEXT_RUNS; ++i) {
+        if (!text_run_descriptors[i].validate_ok) {
+            run = &text_run_descriptors[i];
+            break;
+        }
+    }
+
+    // Drop out if not found
+    if (!run) {
+        qp_dprintf("qp_make_text_run: fail (no free slot)\n");
+        return NULL;
+    }
+
+    int16_t width = qp_textwidth(font, str);
+    if (width <= 0) {
+        qp_dprintf("qp_make_text_run: fail (nothing to render)\n");
+        return NULL;
+    }
+
+    run->device      = device;
+    run->base.width  = width;
+    run->base.height = qff_font->base.line_height;
+    run->buffer      = malloc(qp_drawtext_native_bytes(device, ((uint32_t)run->base.width) * run->base.height));
+    if (run->buffer == NULL) {
+        qp_dprintf("qp_make_text_run: fail (could not allocate enough RAM for text run)\n");
+        return NULL;
+    }
+
+    bool ret = false;
+    do {
+        // Set up the byte input state and input callback
+        qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qff_font->stream};
+        qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme);
+        if (input_callback == NULL) {
+            qp_dprintf("qp_make_text_run: fail (invalid font compression scheme)\n");
+            break;
+        }
+
+        qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+        qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+        uint32_t   data_offset;
+        if (!qp_drawtext_prepare_font_for_render(device, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
+            qp_dprintf("qp_make_text_run: fail (failed to prepare font for rendering)\n");
+            break;
+        }
+
+        // Iterate the codepoints, rendering each glyph into the run
+        code_point_iter_rendertorun_state_t state = {.device = device, .run = run, .xpos = 0, .input_callback = input_callback, .input_state = &input_state};
+        ret                                       = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_rendertorun, &state);
+    } while (0);
+
+    if (!ret) {
+        free(run->buffer);
+        run->buffer = NULL;
+        return NULL;
+    }
+
+    run->validate_ok = true;
+    qp_dprintf("qp_make_text_run: ok\n");
+    return (painter_text_run_handle_t)run;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext_run
+
+int16_t qp_drawtext_run(painter_device_t device, uint16_t x, uint16_t y, painter_text_run_handle_t run) {
+    qp_dprintf("qp_drawtext_run: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_drawtext_run: fail (validation_ok == false)\n");
+        return 0;
+    }
+
+    qp_text_run_t *text_run = (qp_text_run_t *)run;
+    if (!text_run || !text_run->validate_ok || text_run->device != device) {
+        qp_dprintf("qp_drawtext_run: fail (invalid text run)\n");
+        return 0;
+    }
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_drawtext_run: fail (could not start comms)\n");
+        return 0;
+    }
+
+    // The whole run is already in native format, so it goes out as a single block of pixel data
+    bool ret = driver->driver_vtable->viewport(device, x, y, x + text_run->base.width - 1, y + text_run->base.height - 1) && driver->driver_vtable->pixdata(device, text_run->buffer, ((uint32_t)text_run->base.width) * text_run->base.height);
+
+    qp_dprintf("qp_drawtext_run: %s\n", ret ? "ok" : "fail");
+    qp_comms_stop(device);
+    return ret ? text_run->base.width : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_close_text_run
+
+bool qp_close_text_run(painter_text_run_handle_t run) {
+    qp_text_run_t *text_run = (qp_text_run_t *)run;
+    if (!text_run || !text_run->validate_ok) {
+        qp_dprintf("qp_close_text_run: fail (invalid text run)\n");
+        return false;
+    }
+
+    // Free up this text run for use elsewhere.
+    free(text_run->buffer);
+    text_run->buffer      = NULL;
+    text_run->validate_ok = false;
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_NUM_TEXT_RUNS > 0
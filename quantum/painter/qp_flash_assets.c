@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "qp_internal.h"
+#include "qp_flash_assets.h"
+#include "flash.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_flash_asset_address
+
+bool qp_flash_asset_address(uint32_t directory, uint16_t index, uint32_t *address, uint32_t *length) {
+    qp_flash_asset_directory_header_t header;
+    if (flash_read_range(directory, &header, sizeof(header)) != FLASH_STATUS_SUCCESS) {
+        qp_dprintf("qp_flash_asset_address: fail (could not read directory header)\n");
+        return false;
+    }
+
+    if (header.magic != QP_FLASH_ASSET_DIRECTORY_MAGIC) {
+        qp_dprintf("qp_flash_asset_address: fail (no directory at 0x%08lX)\n", (unsigned long)directory);
+        return false;
+    }
+
+    if (index >= header.entry_count) {
+        qp_dprintf("qp_flash_asset_address: fail (index %d out of range, directory has %d entries)\n", (int)index, (int)header.entry_count);
+        return false;
+    }
+
+    qp_flash_asset_directory_entry_t entry;
+    if (flash_read_range(directory + sizeof(header) + index * sizeof(entry), &entry, sizeof(entry)) != FLASH_STATUS_SUCCESS) {
+        qp_dprintf("qp_flash_asset_address: fail (could not read directory entry)\n");
+        return false;
+    }
+
+    *address = directory + entry.offset;
+    if (length) {
+        *length = entry.length;
+    }
+    return true;
+}
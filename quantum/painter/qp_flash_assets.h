@@ -0,0 +1,53 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "compiler_support.h"
+#include "util.h"
+
+/*
+    Asset directories for images and fonts stored in external flash.
+
+    A directory is a small table written to flash alongside the QGF/QFF files it describes, so that firmware only needs
+    to know where the directory lives rather than the address of every asset. All values are little-endian:
+
+        offset  size  description
+        0       4     magic, "QPAD"
+        4       2     number of entries
+        6       2     reserved, zero
+        8       8*n   entries, each holding the asset's offset from the start of the directory (4 bytes) and its
+                      length in bytes (4 bytes)
+
+    Assets are referred to by their index within the directory.
+*/
+
+#define QP_FLASH_ASSET_DIRECTORY_MAGIC 0x44415051 // "QPAD"
+
+typedef struct PACKED qp_flash_asset_directory_header_t {
+    uint32_t magic;
+    uint16_t entry_count;
+    uint16_t reserved;
+} qp_flash_asset_directory_header_t;
+
+STATIC_ASSERT(sizeof(qp_flash_asset_directory_header_t) == 8, "qp_flash_asset_directory_header_t must be 8 bytes in size");
+
+typedef struct PACKED qp_flash_asset_directory_entry_t {
+    uint32_t offset;
+    uint32_t length;
+} qp_flash_asset_directory_entry_t;
+
+STATIC_ASSERT(sizeof(qp_flash_asset_directory_entry_t) == 8, "qp_flash_asset_directory_entry_t must be 8 bytes in size");
+
+/**
+ * Looks up an asset within a directory stored in external flash.
+ *
+ * @param directory[in] the flash address of the asset directory
+ * @param index[in] the index of the asset within the directory
+ * @param address[out] the flash address of the asset, suitable for \ref qp_load_image_flash or \ref qp_load_font_flash
+ * @param length[out] the length of the asset in bytes, may be NULL
+ * @return true if the asset was found
+ */
+bool qp_flash_asset_address(uint32_t directory, uint16_t index, uint32_t *address, uint32_t *length);
@@ -84,6 +84,12 @@ void qp_internal_task(void) {
     qp_internal_display_timeout_task();
 #endif // (QUANTUM_PAINTER_DISPLAY_TIMEOUT) > 0
 
+#if defined(QUANTUM_PAINTER_SPI_ENABLE) && QUANTUM_PAINTER_SPI_ASYNC
+    // Release the SPI bus once any background pixel data transfer has completed
+    void qp_comms_spi_async_task(void);
+    qp_comms_spi_async_task();
+#endif // defined(QUANTUM_PAINTER_SPI_ENABLE) && QUANTUM_PAINTER_SPI_ASYNC
+
     // Handle animations
     void qp_internal_animation_tick(void);
     qp_internal_animation_tick();
@@ -164,3 +164,100 @@ qp_file_stream_t qp_make_file_stream(FILE *f) {
     return stream;
 }
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+
+#    include "flash.h"
+#    include "qp_comms.h"
+
+static inline int16_t flash_stream_get(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    if (s->position >= s->length) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+
+    // Refill the read-ahead buffer from the current position if it doesn't hold the requested byte. Decoding mostly
+    // walks forwards, so one flash transaction normally serves many calls.
+    int32_t offset = s->position - s->buffer_position;
+    if (offset < 0 || offset >= s->buffer_length) {
+        // The flash usually shares the display's SPI bus, so the display in the middle of drawing has to let go of it
+        uint16_t         length  = MIN(sizeof(s->buffer), (uint32_t)(s->length - s->position));
+        painter_device_t display = qp_comms_suspend();
+        flash_status_t   status  = flash_read_range(s->address + s->position, s->buffer, length);
+        if (!qp_comms_resume(display) || status != FLASH_STATUS_SUCCESS) {
+            s->buffer_length = 0;
+            s->is_eof        = true;
+            return STREAM_EOF;
+        }
+        s->buffer_position = s->position;
+        s->buffer_length   = length;
+        offset             = 0;
+    }
+
+    s->position++;
+    return s->buffer[offset];
+}
+
+static inline bool flash_stream_put(qp_stream_t *stream, uint8_t c) {
+    // Flash needs erasing before it can be written, which doesn't suit a stream -- read only.
+    return false;
+}
+
+static inline int flash_stream_seek(qp_stream_t *stream, int32_t offset, int origin) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+
+    // Handle as per fseek
+    int32_t position = s->position;
+    switch (origin) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position += offset;
+            break;
+        case SEEK_END:
+            position = s->length + offset;
+            break;
+        default:
+            return -1;
+    }
+
+    // As per memory streams, seeking to the end is okay but not beyond it
+    if (position < 0 || position > s->length) {
+        return -1;
+    }
+
+    // The read-ahead buffer is kept, so seeking back within it (such as when re-reading a block header) is free
+    s->position = position;
+    s->is_eof   = false;
+    return 0;
+}
+
+static inline int32_t flash_stream_tell(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->position;
+}
+
+static inline bool flash_stream_is_eof(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->is_eof;
+}
+
+static inline void flash_stream_close(qp_stream_t *stream) {
+    // No-op.
+}
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length) {
+    qp_flash_stream_t stream = {
+        .base    = {.get = flash_stream_get, .put = flash_stream_put, .seek = flash_stream_seek, .tell = flash_stream_tell, .is_eof = flash_stream_is_eof, .close = flash_stream_close},
+        .address = address,
+        .length  = length,
+    };
+    return stream;
+}
+
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
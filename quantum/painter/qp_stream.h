@@ -83,3 +83,23 @@ typedef struct qp_file_stream_t {
 qp_file_stream_t qp_make_file_stream(FILE *f);
 
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef QUANTUM_PAINTER_FLASH_ENABLE
+
+typedef struct qp_flash_stream_t {
+    qp_stream_t base;
+    uint32_t    address; // flash address of the start of the stream
+    int32_t     length;
+    int32_t     position;
+    bool        is_eof;
+    int32_t     buffer_position; // stream position of the first byte held in the read-ahead buffer
+    uint16_t    buffer_length;   // number of valid bytes held in the read-ahead buffer
+    uint8_t     buffer[QUANTUM_PAINTER_FLASH_READ_AHEAD_SIZE];
+} qp_flash_stream_t;
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length);
+
+#endif // QUANTUM_PAINTER_FLASH_ENABLE
@@ -1,6 +1,8 @@
 # Quantum Painter Configurables
 QUANTUM_PAINTER_DRIVERS ?=
 QUANTUM_PAINTER_ANIMATIONS_ENABLE ?= yes
+QUANTUM_PAINTER_DISPLAY_LIST_ENABLE ?= no
+QUANTUM_PAINTER_FLASH_ENABLE ?= no
 
 QUANTUM_PAINTER_LVGL_INTEGRATION ?= no
 
@@ -238,6 +240,20 @@ endef
 # Iterate through the listed drivers for the build, including what's necessary
 $(foreach qp_driver,$(QUANTUM_PAINTER_DRIVERS),$(eval $(call handle_quantum_painter_driver,$(qp_driver))))
 
+# Tiled rendering draws each tile into a surface
+ifeq ($(strip $(QUANTUM_PAINTER_DISPLAY_LIST_ENABLE)), yes)
+    QUANTUM_PAINTER_NEEDS_SURFACE := yes
+    OPT_DEFS += -DQUANTUM_PAINTER_DISPLAY_LIST_ENABLE
+    SRC += $(QUANTUM_DIR)/painter/qp_display_list.c
+endif
+
+# Images and fonts can be read from external flash, through the flash driver
+ifeq ($(strip $(QUANTUM_PAINTER_FLASH_ENABLE)), yes)
+    FLASH_DRIVER ?= spi
+    OPT_DEFS += -DQUANTUM_PAINTER_FLASH_ENABLE
+    SRC += $(QUANTUM_DIR)/painter/qp_flash_assets.c
+endif
+
 # If a surface is needed, set up the required files
 ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_SURFACE)), yes)
     QUANTUM_PAINTER_NEEDS_COMMS_DUMMY := yes
@@ -246,6 +262,7 @@ ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_SURFACE)), yes)
         $(DRIVER_PATH)/painter/generic
     SRC += \
         $(DRIVER_PATH)/painter/generic/qp_surface_common.c \
+        $(DRIVER_PATH)/painter/generic/qp_surface_compose.c \
         $(DRIVER_PATH)/painter/generic/qp_surface_mono1bpp.c \
         $(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
         $(DRIVER_PATH)/painter/generic/qp_surface_rgb888.c
@@ -0,0 +1,281 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_draw.h"
+#include "qp_surface_internal.h"
+#include "qgf.h"
+}
+
+#define TEST_WIDTH 96
+#define TEST_HEIGHT 64
+#define TEST_PIXELS (TEST_WIDTH * TEST_HEIGHT)
+
+// RLE encoding as produced by the QGF converter: markers below 128 repeat the next byte, others are followed by literal bytes
+static std::vector<uint8_t> rle_encode(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    size_t               i = 0;
+    while (i < data.size()) {
+        size_t run = 1;
+        while (i + run < data.size() && run < 127 && data[i + run] == data[i]) {
+            ++run;
+        }
+        if (run >= 3) {
+            out.push_back(run);
+            out.push_back(data[i]);
+            i += run;
+            continue;
+        }
+
+        size_t literal = 0;
+        while (i + literal < data.size() && literal < 128 && !(i + literal + 2 < data.size() && data[i + literal] == data[i + literal + 1] && data[i + literal] == data[i + literal + 2])) {
+            ++literal;
+        }
+        out.push_back(127 + literal);
+        out.insert(out.end(), data.begin() + i, data.begin() + i + literal);
+        i += literal;
+    }
+    return out;
+}
+
+// Greedy LZ encoding, following the same format as the QGF converter
+static void lz_append_length(std::vector<uint8_t> &out, size_t length) {
+    for (length -= 15; length >= 255; length -= 255) {
+        out.push_back(255);
+    }
+    out.push_back(length);
+}
+
+static std::vector<uint8_t> lz_encode(const std::vector<uint8_t> &data) {
+    std::vector<uint8_t> out;
+    size_t               literal_start = 0;
+    size_t               pos           = 0;
+    while (pos <= data.size()) {
+        size_t best_length = 0, best_offset = 0;
+        for (size_t offset = 1; pos < data.size() && offset <= QGF_LZ_WINDOW_SIZE && offset <= pos; ++offset) {
+            size_t length = 0;
+            while (pos + length < data.size() && data[pos + length - offset] == data[pos + length]) {
+                ++length;
+            }
+            if (length > best_length) {
+                best_length = length;
+                best_offset = offset;
+            }
+        }
+
+        bool at_end = pos == data.size();
+        if (best_length < QGF_LZ_MIN_MATCH && !at_end) {
+            ++pos;
+            continue;
+        }
+        if (at_end && literal_start == pos) {
+            break;
+        }
+
+        size_t literals   = pos - literal_start;
+        size_t match_code = at_end ? 0 : best_length - QGF_LZ_MIN_MATCH;
+        out.push_back((std::min<size_t>(literals, 15) << 4) | std::min<size_t>(match_code, 15));
+        if (literals >= 15) {
+            lz_append_length(out, literals);
+        }
+        out.insert(out.end(), data.begin() + literal_start, data.begin() + pos);
+        if (at_end) {
+            break;
+        }
+        out.push_back(best_offset & 0xFF);
+        out.push_back(best_offset >> 8);
+        if (match_code >= 15) {
+            lz_append_length(out, match_code);
+        }
+        pos += best_length;
+        literal_start = pos;
+    }
+    return out;
+}
+
+class QPCodec : public ::testing::TestWithParam<std::tuple<int, painter_compression_t, bool>> {
+   protected:
+    uint8_t          buffer_a[TEST_PIXELS * 3];
+    uint8_t          buffer_b[TEST_PIXELS * 3];
+    painter_device_t device_a;
+    painter_device_t device_b;
+
+    void SetUp() override {
+        memset(surface_drivers, 0, sizeof(surface_drivers));
+        memset(buffer_a, 0, sizeof(buffer_a));
+        memset(buffer_b, 0, sizeof(buffer_b));
+        if (rgb888()) {
+            device_a = qp_make_rgb888_surface(TEST_WIDTH, TEST_HEIGHT, buffer_a);
+            device_b = qp_make_rgb888_surface(TEST_WIDTH, TEST_HEIGHT, buffer_b);
+        } else {
+            device_a = qp_make_rgb565_surface(TEST_WIDTH, TEST_HEIGHT, buffer_a);
+            device_b = qp_make_rgb565_surface(TEST_WIDTH, TEST_HEIGHT, buffer_b);
+        }
+        ASSERT_TRUE(qp_init(device_a, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(device_b, QP_ROTATION_0));
+
+        // Distinct native colors for every palette entry
+        for (int i = 0; i < 256; ++i) {
+            qp_internal_global_pixel_lookup_table[i].hsv888 = (hsv_t){.h = (uint8_t)i, .s = 255, .v = (uint8_t)(255 - i / 2)};
+        }
+        painter_driver_t *driver = (painter_driver_t *)device_a;
+        driver->driver_vtable->palette_convert(device_a, 256, qp_internal_global_pixel_lookup_table);
+    }
+
+    int bpp(void) const {
+        return std::get<0>(GetParam());
+    }
+    painter_compression_t compression(void) const {
+        return std::get<1>(GetParam());
+    }
+    bool rgb888(void) const {
+        return std::get<2>(GetParam());
+    }
+
+    // Packed indices with some longer runs, so that RLE has something to do
+    std::vector<uint8_t> make_input(uint32_t pixel_count) {
+        std::mt19937         rng(bpp() * 7 + compression());
+        std::vector<uint8_t> data((pixel_count * bpp() + 7) / 8);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = (rng() % 4 == 0 && i > 0) ? data[i - 1] : (uint8_t)rng();
+        }
+        switch (compression()) {
+            case IMAGE_COMPRESSED_RLE:
+                return rle_encode(data);
+            case IMAGE_COMPRESSED_LZ:
+                return lz_encode(data);
+            default:
+                return data;
+        }
+    }
+
+    // Per-pixel decoder, as used before the bulk decode path was added
+    bool decode_reference(painter_device_t device, const std::vector<uint8_t> &input, uint32_t pixel_count) {
+        qp_memory_stream_t              stream         = qp_make_memory_stream((void *)input.data(), input.size());
+        qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = (qp_stream_t *)&stream};
+        qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, compression());
+        qp_internal_pixel_output_state_t output_state  = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
+
+        painter_driver_t *driver = (painter_driver_t *)device;
+        bool              ret    = driver->driver_vtable->viewport(device, 0, 0, TEST_WIDTH - 1, TEST_HEIGHT - 1);
+        ret                      = ret && qp_internal_decode_palette(device, pixel_count, bpp(), input_callback, &input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+        if (ret && output_state.pixel_write_pos > 0) {
+            ret = driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+        }
+        return ret;
+    }
+
+    bool decode_bulk(painter_device_t device, const std::vector<uint8_t> &input, uint32_t pixel_count) {
+        qp_memory_stream_t              stream         = qp_make_memory_stream((void *)input.data(), input.size());
+        qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = (qp_stream_t *)&stream};
+        qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, compression());
+
+        painter_driver_t *driver = (painter_driver_t *)device;
+        return driver->driver_vtable->viewport(device, 0, 0, TEST_WIDTH - 1, TEST_HEIGHT - 1) && qp_internal_appender(device, bpp(), pixel_count, input_callback, &input_state);
+    }
+};
+
+TEST_P(QPCodec, BulkDecode_MatchesPerPixel) {
+    // Odd pixel counts leave partial input bytes at the end
+    for (uint32_t pixel_count : {1u, 7u, 333u, (uint32_t)TEST_PIXELS}) {
+        std::vector<uint8_t> input = make_input(pixel_count);
+        memset(buffer_a, 0, sizeof(buffer_a));
+        memset(buffer_b, 0, sizeof(buffer_b));
+        ASSERT_TRUE(decode_reference(device_a, input, pixel_count));
+        ASSERT_TRUE(decode_bulk(device_b, input, pixel_count));
+        EXPECT_EQ(memcmp(buffer_a, buffer_b, sizeof(buffer_a)), 0) << pixel_count << " pixels";
+    }
+}
+
+/**
+ * Times both decoders over the same image on the host. The timings are recorded as test properties, so that they show up
+ * in the XML/JSON output without cluttering the console.
+ */
+TEST_P(QPCodec, Benchmark) {
+    std::vector<uint8_t> input = make_input(TEST_PIXELS);
+    const int            loops = 20;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; ++i) {
+        ASSERT_TRUE(decode_reference(device_a, input, TEST_PIXELS));
+    }
+    auto reference = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < loops; ++i) {
+        ASSERT_TRUE(decode_bulk(device_b, input, TEST_PIXELS));
+    }
+    auto bulk = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(memcmp(buffer_a, buffer_b, sizeof(buffer_a)), 0);
+    auto us = [](std::chrono::steady_clock::duration d) { return (int)std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    RecordProperty("per_pixel_us", us(reference));
+    RecordProperty("bulk_us", us(bulk));
+}
+
+INSTANTIATE_TEST_CASE_P(Formats, QPCodec, ::testing::Combine(::testing::Values(1, 2, 4, 8), ::testing::Values(IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE, IMAGE_COMPRESSED_LZ), ::testing::Bool()));
+
+// Output of the QGF converter's LZ encoder, covering extended literal lengths, overlapping and extended matches
+static const std::vector<uint8_t> converter_lz_output = {
+    255, 189, 0,   1,   2,   6,   1,   0,   12,  10,  11,  13,  12,  11,  17,  18,  20,  24,  27,  26,  26,  27,  24,  35,  34,  33,  43,  44,  45,  43,  45,  44,  48,  49,  54,  50,  49,  55,  61,  62,  63,  69,  68,  71,  70,  71,  68,  72,  79,  78,  86,  80,  81,  87,  86,  81,  95,  92,  90,  94,  93,  92,  96,  97,  98,  105, 104, 107, 109, 106, 107, 117, 115, 114, 122, 123, 124, 120, 123, 125, 131, 128, 129, 131, 130, 129, 140, 141, 142, 146, 149, 148, 144, 150, 151, 153, 152, 159, 165, 166, 160, 164, 167, 166, 174, 175, 172, 175, 174, 173, 183, 176, 177, 191, 185, 184, 188, 189, 186, 198, 197, 195, 201, 202, 203, 201, 200, 203, 210, 211, 208, 212, 211, 210, 218, 220, 221, 227, 226, 229, 227, 224, 230, 234, 233, 232, 244, 245, 246, 245, 244, 247, 249, 254, 255, 249, 255, 254, 6,   7,   0,   12,  15,  9,   15,  12,  13,  23,  22,  21,  24,  25,  26,  30,  25,  24,  36,  34,  35,  37,  36,  35,  41,  42,  44,  48,  51,  50,  50,  51,  48,  59,  58,  57,  67,  68,  69,  67,  69,  68,  72,  73,  17,  34,  51,  68,  4,   0,   57,  240, 25,  0,   1,   2,   3,   4,   5,   6,   7,   8,   9,   10,  11,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,
+};
+
+TEST(QPCodecLZ, ConverterOutput_Decodes) {
+    std::vector<uint8_t> expected;
+    for (int i = 0; i < 200; ++i) {
+        expected.push_back(((i / 3 * 5) ^ (i % 7)) & 0xFF);
+    }
+    for (int i = 0; i < 20; ++i) {
+        expected.insert(expected.end(), {0x11, 0x22, 0x33, 0x44});
+    }
+    for (int i = 0; i < 40; ++i) {
+        expected.push_back(i);
+    }
+
+    qp_memory_stream_t              stream         = qp_make_memory_stream((void *)converter_lz_output.data(), converter_lz_output.size());
+    qp_internal_byte_input_state_t  input_state    = {.device = NULL, .src_stream = (qp_stream_t *)&stream};
+    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, IMAGE_COMPRESSED_LZ);
+    ASSERT_NE(input_callback, nullptr);
+
+    std::vector<uint8_t> decoded;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        int16_t byteval = input_callback(&input_state);
+        ASSERT_GE(byteval, 0) << "byte " << i;
+        decoded.push_back(byteval);
+    }
+    EXPECT_EQ(decoded, expected);
+    EXPECT_EQ(qp_stream_tell(&stream), (int32_t)converter_lz_output.size()) << "All of the input should have been consumed";
+}
+
+TEST(QPCodecLZ, InvalidOffset_Fails) {
+    // Four literals, then a match reaching back before the start of the window
+    static const uint8_t            input[]        = {0x40, 1, 2, 3, 4, 0x01, 0x04};
+    qp_memory_stream_t              stream         = qp_make_memory_stream((void *)input, sizeof(input));
+    qp_internal_byte_input_state_t  input_state    = {.device = NULL, .src_stream = (qp_stream_t *)&stream};
+    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, IMAGE_COMPRESSED_LZ);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(input_callback(&input_state), i + 1);
+    }
+    EXPECT_LT(input_callback(&input_state), 0);
+}
+
+TEST(QPCodecLZ, OffsetBeyondDecoded_Fails) {
+    // Four literals, then a match within the window size, but reaching back further than anything decoded so far
+    static const uint8_t            input[]        = {0x40, 1, 2, 3, 4, 0x05, 0x00};
+    qp_memory_stream_t              stream         = qp_make_memory_stream((void *)input, sizeof(input));
+    qp_internal_byte_input_state_t  input_state    = {.device = NULL, .src_stream = (qp_stream_t *)&stream};
+    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, IMAGE_COMPRESSED_LZ);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(input_callback(&input_state), i + 1);
+    }
+    EXPECT_LT(input_callback(&input_state), 0);
+}
@@ -0,0 +1,155 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+#include "qp_virtual_panel.h"
+}
+
+#define TEST_WIDTH 64
+#define TEST_HEIGHT 48
+#define WIDGET_WIDTH 20
+#define WIDGET_HEIGHT 10
+#define MAX_BUFFER_SIZE SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_WIDTH, TEST_HEIGHT, 24)
+
+class QPCompose : public ::testing::TestWithParam<int> {
+   protected:
+    uint8_t            gram[MAX_BUFFER_SIZE];
+    uint8_t            background_buffer[MAX_BUFFER_SIZE];
+    uint8_t            widget_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(WIDGET_WIDTH, WIDGET_HEIGHT, 24)];
+    uint8_t            overlay_buffer[MAX_BUFFER_SIZE];
+    painter_device_t   panel;
+    qp_surface_layer_t layers[3];
+
+    void SetUp() override {
+        memset(surface_drivers, 0, sizeof(surface_drivers));
+        panel = qp_virtual_panel_make_device(TEST_WIDTH, TEST_HEIGHT, bpp(), gram);
+        ASSERT_NE(panel, nullptr);
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+
+        layers[0] = {.surface = make_surface(TEST_WIDTH, TEST_HEIGHT, background_buffer), .alpha = 255};
+        layers[1] = {.surface = make_surface(WIDGET_WIDTH, WIDGET_HEIGHT, widget_buffer), .x = 10, .y = 20, .alpha = 255};
+        layers[2] = {.surface = make_surface(TEST_WIDTH, TEST_HEIGHT, overlay_buffer), .alpha = 255, .keyed = true};
+
+        // Red background, blue widget, and a transparent overlay with a white marker
+        EXPECT_TRUE(qp_rect(layers[0].surface, 0, 0, TEST_WIDTH - 1, TEST_HEIGHT - 1, 0, 255, 255, true));
+        EXPECT_TRUE(qp_rect(layers[1].surface, 0, 0, WIDGET_WIDTH - 1, WIDGET_HEIGHT - 1, 170, 255, 255, true));
+        EXPECT_TRUE(qp_rect(layers[2].surface, 0, 0, 3, 3, 0, 0, 255, true));
+        EXPECT_TRUE(qp_surface_compose(panel, 0, 0, layers, 3, true));
+        qp_virtual_panel_reset_stats(panel);
+    }
+
+    void TearDown() override {
+        qp_virtual_panel_release(panel);
+    }
+
+    int bpp(void) const {
+        return GetParam();
+    }
+
+    painter_device_t make_surface(uint16_t width, uint16_t height, void *buffer) {
+        painter_device_t surface = bpp() == 16 ? qp_make_rgb565_surface(width, height, buffer) : qp_make_rgb888_surface(width, height, buffer);
+        EXPECT_NE(surface, nullptr);
+        EXPECT_TRUE(qp_init(surface, QP_ROTATION_0));
+        return surface;
+    }
+
+    rgb_t pixel(uint16_t x, uint16_t y) {
+        return qp_virtual_panel_get_pixel(panel, x, y);
+    }
+};
+
+TEST_P(QPCompose, Layers_StackInOrder) {
+    EXPECT_EQ(pixel(0, 10).r, 255) << "Background";
+    EXPECT_EQ(pixel(10, 20).b, 255) << "Widget, at its position";
+    EXPECT_EQ(pixel(10 + WIDGET_WIDTH - 1, 20 + WIDGET_HEIGHT - 1).b, 255);
+    EXPECT_EQ(pixel(10 + WIDGET_WIDTH, 20).r, 255);
+    EXPECT_EQ(pixel(0, 0).g, 255) << "Overlay marker";
+    EXPECT_EQ(pixel(4, 4).r, 255) << "Keyed overlay pixels let the layers below through";
+    EXPECT_EQ(pixel(4, 4).g, 0);
+}
+
+TEST_P(QPCompose, Alpha_BlendsWithLayersBelow) {
+    layers[1].alpha = 128;
+    EXPECT_TRUE(qp_surface_compose(panel, 0, 0, layers, 3, true));
+
+    // Half blue over red, within the panel's native precision
+    rgb_t blended = pixel(15, 25);
+    EXPECT_NEAR(blended.r, 127, 8);
+    EXPECT_NEAR(blended.b, 128, 8);
+    EXPECT_EQ(blended.g, 0);
+    if (bpp() == 24) {
+        EXPECT_EQ(blended.r, 127);
+        EXPECT_EQ(blended.b, 128);
+    }
+
+    layers[1].alpha = 0;
+    EXPECT_TRUE(qp_surface_compose(panel, 0, 0, layers, 3, true));
+    EXPECT_EQ(pixel(15, 25).r, 255) << "Hidden layers are skipped";
+}
+
+TEST_P(QPCompose, DirtyRegions_OnlyChangesSent) {
+    // Nothing changed since the last composition
+    EXPECT_TRUE(qp_surface_compose(panel, 0, 0, layers, 3, false));
+    EXPECT_EQ(qp_virtual_panel_get_stats(panel)->windows, 0u);
+
+    // A change inside the widget is sent in composition coordinates, and only covers the changed pixels
+    EXPECT_TRUE(qp_rect(layers[1].surface, 2, 3, 5, 4, 85, 255, 255, true));
+    EXPECT_TRUE(qp_surface_compose(panel, 0, 0, layers, 3, false));
+    const qp_virtual_panel_stats_t *stats = qp_virtual_panel_get_stats(panel);
+    EXPECT_EQ(stats->windows, 1u);
+    EXPECT_EQ(stats->pixels, 4u * 2);
+    EXPECT_EQ(pixel(12, 23).g, 255);
+    EXPECT_EQ(pixel(11, 23).b, 255);
+
+    // Changes in separate layers at opposite corners stay separate
+    qp_virtual_panel_reset_stats(panel);
+    EXPECT_TRUE(qp_rect(layers[0].surface, 60, 44, 63, 47, 85, 255, 255, true));
+    EXPECT_TRUE(qp_rect(layers[2].surface, 0, 0, 1, 1, 0, 0, 0, true));
+    EXPECT_TRUE(qp_surface_compose(panel, 0, 0, layers, 3, false));
+    EXPECT_EQ(stats->windows, 2u);
+    EXPECT_EQ(stats->pixels, 4u * 4 + 2 * 2);
+    EXPECT_EQ(pixel(0, 0).r, 255) << "Overlay marker partially erased back to the color key";
+    EXPECT_EQ(pixel(2, 2).g, 255);
+
+    // Changes hidden underneath an opaque layer are still recomposited, but stay hidden
+    qp_virtual_panel_reset_stats(panel);
+    EXPECT_TRUE(qp_rect(layers[0].surface, 12, 22, 13, 23, 85, 255, 255, true));
+    EXPECT_TRUE(qp_surface_compose(panel, 0, 0, layers, 3, false));
+    EXPECT_EQ(stats->windows, 1u);
+    EXPECT_EQ(pixel(13, 22).b, 255);
+    EXPECT_EQ(stats->clipped_pixels, 0u);
+}
+
+TEST_P(QPCompose, Offset_PlacesComposition) {
+    uint8_t          small_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(WIDGET_WIDTH, WIDGET_HEIGHT, 24)];
+    painter_device_t small = make_surface(WIDGET_WIDTH, WIDGET_HEIGHT, small_buffer);
+    EXPECT_TRUE(qp_rect(small, 0, 0, WIDGET_WIDTH - 1, WIDGET_HEIGHT - 1, 85, 255, 255, true));
+
+    // The widget layer hangs off the bottom-right of the small background, and is clipped to it
+    qp_surface_layer_t stack[2] = {{.surface = small, .alpha = 255}, {.surface = layers[1].surface, .x = 15, .y = 5, .alpha = 255}};
+    EXPECT_TRUE(qp_surface_compose(panel, 40, 30, stack, 2, true));
+    EXPECT_EQ(qp_virtual_panel_get_stats(panel)->pixels, (uint32_t)WIDGET_WIDTH * WIDGET_HEIGHT);
+    EXPECT_EQ(pixel(40, 30).g, 255);
+    EXPECT_EQ(pixel(40 + 15, 30 + 5).b, 255);
+    EXPECT_EQ(pixel(40 + WIDGET_WIDTH, 30 + 5).r, 255) << "Nothing drawn beyond the background layer";
+}
+
+TEST_P(QPCompose, Incompatible_Rejected) {
+    uint8_t          mono_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_WIDTH, TEST_HEIGHT, 1)];
+    painter_device_t mono = qp_make_mono1bpp_surface(TEST_WIDTH, TEST_HEIGHT, mono_buffer);
+    ASSERT_TRUE(qp_init(mono, QP_ROTATION_0));
+
+    qp_surface_layer_t stack[2] = {layers[0], {.surface = mono, .alpha = 255}};
+    EXPECT_FALSE(qp_surface_compose(panel, 0, 0, stack, 2, true));
+    EXPECT_FALSE(qp_surface_compose(panel, 0, 0, layers, 0, true));
+    EXPECT_EQ(qp_virtual_panel_get_stats(panel)->windows, 0u);
+}
+
+INSTANTIATE_TEST_CASE_P(Formats, QPCompose, ::testing::Values(16, 24));
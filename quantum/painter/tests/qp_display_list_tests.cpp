@@ -0,0 +1,154 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#include "qp_test_assets.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+#include "qp_virtual_panel.h"
+}
+
+// Deliberately not a multiple of the tile size, so that the last row and column of tiles overlap their neighbours
+#define TEST_WIDTH 100
+#define TEST_HEIGHT 70
+#define TILE_WIDTH 32
+#define TILE_HEIGHT 16
+
+class QPDisplayList : public ::testing::Test {
+   protected:
+    uint8_t              gram[QP_VIRTUAL_PANEL_BUFFER_SIZE(TEST_WIDTH, TEST_HEIGHT, 16)];
+    uint8_t              reference_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_WIDTH, TEST_HEIGHT, 16)];
+    uint8_t              tile_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TILE_WIDTH, TILE_HEIGHT, 16)];
+    painter_device_t     panel;
+    painter_device_t     reference;
+    painter_device_t     tile;
+    qp_display_list_op_t ops[16];
+    qp_display_list_t    list;
+    TestFont             font_data;
+    TestImage            image_data{24, 20};
+
+    void SetUp() override {
+        memset(surface_drivers, 0, sizeof(surface_drivers));
+        panel = qp_virtual_panel_make_device(TEST_WIDTH, TEST_HEIGHT, 16, gram);
+        ASSERT_NE(panel, nullptr);
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+        reference = qp_make_rgb565_surface(TEST_WIDTH, TEST_HEIGHT, reference_buffer);
+        ASSERT_TRUE(qp_init(reference, QP_ROTATION_0));
+        tile = qp_make_rgb565_surface(TILE_WIDTH, TILE_HEIGHT, tile_buffer);
+        ASSERT_TRUE(qp_init(tile, QP_ROTATION_0));
+        qp_display_list_init(&list, ops, sizeof(ops) / sizeof(ops[0]), 170, 255, 64);
+        qp_virtual_panel_reset_stats(panel);
+    }
+
+    void TearDown() override {
+        qp_virtual_panel_release(panel);
+    }
+
+    // Overlapping widgets, most of them straddling tile boundaries
+    void record_scene(painter_image_handle_t image, painter_font_handle_t font) {
+        EXPECT_TRUE(qp_display_list_rect(&list, 5, 5, 60, 40, 0, 255, 255, true));
+        EXPECT_TRUE(qp_display_list_drawimage(&list, 20, 10, image));
+        EXPECT_TRUE(qp_display_list_circle(&list, 50, 30, 20, 85, 255, 255, true));
+        EXPECT_TRUE(qp_display_list_rect(&list, 30, 14, 90, 50, 0, 0, 255, false));
+        EXPECT_TRUE(qp_display_list_line(&list, 0, 69, 99, 3, 43, 255, 255));
+        EXPECT_TRUE(qp_display_list_ellipse(&list, 70, 55, 25, 10, 200, 255, 255, false));
+        EXPECT_TRUE(qp_display_list_drawtext_recolor(&list, 40, 28, font, "Tiles", 0, 0, 255, 0, 0, 0));
+    }
+
+    // The same scene, drawn directly into a full framebuffer
+    void draw_reference(painter_image_handle_t image, painter_font_handle_t font) {
+        EXPECT_TRUE(qp_rect(reference, 0, 0, TEST_WIDTH - 1, TEST_HEIGHT - 1, 170, 255, 64, true));
+        EXPECT_TRUE(qp_rect(reference, 5, 5, 60, 40, 0, 255, 255, true));
+        EXPECT_TRUE(qp_drawimage(reference, 20, 10, image));
+        EXPECT_TRUE(qp_circle(reference, 50, 30, 20, 85, 255, 255, true));
+        EXPECT_TRUE(qp_rect(reference, 30, 14, 90, 50, 0, 0, 255, false));
+        EXPECT_TRUE(qp_line(reference, 0, 69, 99, 3, 43, 255, 255));
+        EXPECT_TRUE(qp_ellipse(reference, 70, 55, 25, 10, 200, 255, 255, false));
+        EXPECT_GT(qp_drawtext_recolor(reference, 40, 28, font, "Tiles", 0, 0, 255, 0, 0, 0), 0);
+    }
+};
+
+TEST_F(QPDisplayList, Render_MatchesFullFramebuffer) {
+    painter_image_handle_t image = qp_load_image_mem(image_data.data.data());
+    painter_font_handle_t  font  = qp_load_font_mem(font_data.data.data());
+    ASSERT_NE(image, nullptr);
+    ASSERT_NE(font, nullptr);
+
+    record_scene(image, font);
+    draw_reference(image, font);
+    EXPECT_TRUE(qp_display_list_render(&list, tile, panel));
+
+    EXPECT_EQ(memcmp(gram, reference_buffer, sizeof(gram)), 0) << "Tiled output should match drawing into a full framebuffer";
+
+    // One transfer per tile, each covering the whole tile
+    const qp_virtual_panel_stats_t *stats = qp_virtual_panel_get_stats(panel);
+    uint32_t                        tiles = ((TEST_WIDTH + TILE_WIDTH - 1) / TILE_WIDTH) * ((TEST_HEIGHT + TILE_HEIGHT - 1) / TILE_HEIGHT);
+    EXPECT_EQ(stats->windows, tiles);
+    EXPECT_EQ(stats->pixels, tiles * TILE_WIDTH * TILE_HEIGHT);
+    EXPECT_EQ(stats->clipped_pixels, 0u);
+    RecordProperty("tile_buffer_bytes", (int)sizeof(tile_buffer));
+    RecordProperty("framebuffer_bytes", (int)sizeof(reference_buffer));
+    RecordProperty("bus_bytes", (int)qp_virtual_panel_bus_bytes(panel));
+
+    // Rendering again sends everything again, even though the tile buffer is unchanged between some tiles
+    qp_virtual_panel_reset_stats(panel);
+    EXPECT_TRUE(qp_display_list_render(&list, tile, panel));
+    EXPECT_EQ(qp_virtual_panel_get_stats(panel)->windows, tiles);
+    EXPECT_EQ(memcmp(gram, reference_buffer, sizeof(gram)), 0);
+
+    EXPECT_TRUE(qp_close_font(font));
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+TEST_F(QPDisplayList, RenderRegion_LeavesRestOfDisplay) {
+    EXPECT_TRUE(qp_display_list_rect(&list, 0, 0, TEST_WIDTH - 1, TEST_HEIGHT - 1, 0, 255, 255, true));
+    EXPECT_TRUE(qp_display_list_render(&list, tile, panel));
+
+    // Move to a new frame, but only redraw the region that changed
+    qp_display_list_clear(&list);
+    EXPECT_TRUE(qp_display_list_rect(&list, 0, 0, TEST_WIDTH - 1, TEST_HEIGHT - 1, 85, 255, 255, true));
+    qp_virtual_panel_reset_stats(panel);
+    EXPECT_TRUE(qp_display_list_render_region(&list, tile, panel, 40, 20, 50, 40));
+
+    // The region straddles two tile rows, and starts a tile at its own top-left corner
+    EXPECT_EQ(qp_virtual_panel_get_stats(panel)->windows, 2u);
+    EXPECT_EQ(qp_virtual_panel_get_pixel(panel, 40, 20).g, 255);
+    EXPECT_EQ(qp_virtual_panel_get_pixel(panel, 40 + TILE_WIDTH - 1, 20 + 2 * TILE_HEIGHT - 1).g, 255);
+    EXPECT_EQ(qp_virtual_panel_get_pixel(panel, 39, 20).r, 255);
+    EXPECT_EQ(qp_virtual_panel_get_pixel(panel, 40, 19).r, 255);
+    EXPECT_EQ(qp_virtual_panel_get_pixel(panel, 40 + TILE_WIDTH, 20).r, 255);
+
+    // Regions hanging off the edge of the display are clipped to it
+    qp_virtual_panel_reset_stats(panel);
+    EXPECT_TRUE(qp_display_list_render_region(&list, tile, panel, TEST_WIDTH - 1, TEST_HEIGHT - 1, UINT16_MAX, UINT16_MAX));
+    EXPECT_EQ(qp_virtual_panel_get_stats(panel)->windows, 1u);
+    EXPECT_EQ(qp_virtual_panel_get_stats(panel)->clipped_pixels, 0u);
+    EXPECT_EQ(qp_virtual_panel_get_pixel(panel, TEST_WIDTH - TILE_WIDTH, TEST_HEIGHT - TILE_HEIGHT).g, 255);
+}
+
+TEST_F(QPDisplayList, Full_RejectsFurtherOps) {
+    for (size_t i = 0; i < sizeof(ops) / sizeof(ops[0]); ++i) {
+        EXPECT_TRUE(qp_display_list_line(&list, 0, i, 10, i, 0, 0, 255));
+    }
+    EXPECT_FALSE(qp_display_list_line(&list, 0, 20, 10, 20, 0, 0, 255));
+    EXPECT_EQ(list.count, sizeof(ops) / sizeof(ops[0]));
+
+    qp_display_list_clear(&list);
+    EXPECT_EQ(list.count, 0u);
+    EXPECT_TRUE(qp_display_list_line(&list, 0, 20, 10, 20, 0, 0, 255));
+}
+
+TEST_F(QPDisplayList, Render_RejectsOversizedTile) {
+    static uint8_t   big_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_WIDTH + 1, TILE_HEIGHT, 16)];
+    painter_device_t big_tile = qp_make_rgb565_surface(TEST_WIDTH + 1, TILE_HEIGHT, big_buffer);
+    ASSERT_NE(big_tile, nullptr);
+    ASSERT_TRUE(qp_init(big_tile, QP_ROTATION_0));
+    EXPECT_FALSE(qp_display_list_render(&list, big_tile, panel));
+    EXPECT_EQ(qp_virtual_panel_get_stats(panel)->windows, 0u);
+}
@@ -0,0 +1,205 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#include "qp_test_assets.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+#include "flash.h"
+#include "flash_spi_sim.h"
+#include "qp_virtual_panel.h"
+#include "spi_master.h"
+
+void set_time(uint32_t t);
+}
+
+#define TEST_WIDTH 64
+#define TEST_HEIGHT 48
+#define DIRECTORY_ADDRESS 0x1000
+
+// Roughly a 16MHz bus, nothing is written while drawing so the program and erase timings don't matter
+static const flash_spi_sim_config_t flash_config = {
+    .bytes_per_sec   = 2000000,
+    .page_program_us = 600,
+    .sector_erase_us = 40000,
+    .block_erase_us  = 500000,
+    .chip_erase_us   = 3000000,
+};
+
+class QPFlash : public ::testing::Test {
+   protected:
+    uint8_t          flash_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_WIDTH, TEST_HEIGHT, 16)];
+    uint8_t          mem_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_WIDTH, TEST_HEIGHT, 16)];
+    painter_device_t flash_surface;
+    painter_device_t mem_surface;
+    TestFont         font_data;
+    TestImage        image_data{TEST_WIDTH, TEST_HEIGHT};
+
+    void SetUp() override {
+        set_time(0);
+        flash_spi_sim_init(&flash_config);
+        flash_init();
+
+        memset(surface_drivers, 0, sizeof(surface_drivers));
+        flash_surface = qp_make_rgb565_surface(TEST_WIDTH, TEST_HEIGHT, flash_buffer);
+        mem_surface   = qp_make_rgb565_surface(TEST_WIDTH, TEST_HEIGHT, mem_buffer);
+        ASSERT_TRUE(qp_init(flash_surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(mem_surface, QP_ROTATION_0));
+
+        // Directory first, followed by the font and then the image
+        TestAsset *assets[] = {&font_data, &image_data};
+        directory_u32(0, QP_FLASH_ASSET_DIRECTORY_MAGIC);
+        directory_u32(4, 2);
+        uint32_t offset = 8 + 2 * 8;
+        for (int i = 0; i < 2; ++i) {
+            directory_u32(8 + i * 8, offset);
+            directory_u32(12 + i * 8, assets[i]->data.size());
+            ASSERT_EQ(flash_write_range(DIRECTORY_ADDRESS + offset, assets[i]->data.data(), assets[i]->data.size()), FLASH_STATUS_SUCCESS);
+            offset += assets[i]->data.size();
+        }
+        ASSERT_EQ(flash_write_range(DIRECTORY_ADDRESS, directory, sizeof(directory)), FLASH_STATUS_SUCCESS);
+    }
+
+    uint32_t reads(void) {
+        const flash_spi_sim_stats_t *stats = flash_spi_sim_get_stats();
+        return stats->transactions - stats->status_polls;
+    }
+
+   private:
+    uint8_t directory[8 + 2 * 8];
+
+    void directory_u32(size_t offset, uint32_t value) {
+        for (int i = 0; i < 4; ++i) {
+            directory[offset + i] = (value >> (i * 8)) & 0xFF;
+        }
+    }
+};
+
+TEST_F(QPFlash, Directory_Lookup) {
+    uint32_t address;
+    uint32_t length;
+    EXPECT_TRUE(qp_flash_asset_address(DIRECTORY_ADDRESS, 1, &address, &length));
+    EXPECT_EQ(address, DIRECTORY_ADDRESS + 8 + 2 * 8 + font_data.data.size());
+    EXPECT_EQ(length, image_data.data.size());
+    EXPECT_EQ(memcmp(flash_spi_sim_memory() + address, image_data.data.data(), length), 0);
+
+    EXPECT_FALSE(qp_flash_asset_address(DIRECTORY_ADDRESS, 2, &address, &length)) << "Index out of range";
+    EXPECT_FALSE(qp_flash_asset_address(0, 0, &address, NULL)) << "Erased flash isn't a directory";
+}
+
+TEST_F(QPFlash, Image_MatchesMemory) {
+    uint32_t address;
+    uint32_t length;
+    ASSERT_TRUE(qp_flash_asset_address(DIRECTORY_ADDRESS, 1, &address, &length));
+
+    painter_image_handle_t flash_image = qp_load_image_flash(address);
+    painter_image_handle_t mem_image   = qp_load_image_mem(image_data.data.data());
+    ASSERT_NE(flash_image, nullptr);
+    ASSERT_NE(mem_image, nullptr);
+    EXPECT_EQ(flash_image->width, TEST_WIDTH);
+    EXPECT_EQ(flash_image->height, TEST_HEIGHT);
+
+    uint32_t               before = reads();
+    flash_spi_sim_stats_t  start  = *flash_spi_sim_get_stats();
+    EXPECT_TRUE(qp_drawimage(flash_surface, 0, 0, flash_image));
+    EXPECT_TRUE(qp_drawimage(mem_surface, 0, 0, mem_image));
+    EXPECT_EQ(memcmp(flash_buffer, mem_buffer, sizeof(flash_buffer)), 0);
+
+    // Decoding walks forwards through the image, so almost every read transaction fills the whole read-ahead buffer
+    uint32_t transactions = reads() - before;
+    EXPECT_LE(transactions, length / QUANTUM_PAINTER_FLASH_READ_AHEAD_SIZE + 4);
+    RecordProperty("read_transactions", (int)transactions);
+    RecordProperty("bus_us", (int)((flash_spi_sim_get_stats()->bus_ns - start.bus_ns) / 1000));
+
+    EXPECT_TRUE(qp_close_image(flash_image));
+    EXPECT_TRUE(qp_close_image(mem_image));
+}
+
+TEST_F(QPFlash, Font_MatchesMemory) {
+    uint32_t address;
+    ASSERT_TRUE(qp_flash_asset_address(DIRECTORY_ADDRESS, 0, &address, NULL));
+
+    painter_font_handle_t flash_font = qp_load_font_flash(address);
+    painter_font_handle_t mem_font   = qp_load_font_mem(font_data.data.data());
+    ASSERT_NE(flash_font, nullptr);
+    ASSERT_NE(mem_font, nullptr);
+    EXPECT_EQ(flash_font->line_height, FONT_HEIGHT);
+
+    const char *str = "Flash!";
+    EXPECT_EQ(qp_textwidth(flash_font, str), qp_textwidth(mem_font, str));
+    EXPECT_GT(qp_drawtext(flash_surface, 2, 2, flash_font, str), 0);
+    EXPECT_GT(qp_drawtext(mem_surface, 2, 2, mem_font, str), 0);
+    EXPECT_EQ(memcmp(flash_buffer, mem_buffer, sizeof(flash_buffer)), 0);
+
+    EXPECT_TRUE(qp_close_font(flash_font));
+    EXPECT_TRUE(qp_close_font(mem_font));
+}
+
+// Stands in for qp_comms_spi.c, holding the simulated bus for as long as the panel's comms are open, as a display
+// sharing the flash's SPI bus would
+static painter_comms_with_command_vtable_t panel_comms;
+static painter_comms_with_command_vtable_t shared_bus_comms;
+
+static bool shared_bus_comms_start(painter_device_t device) {
+    return spi_start(EXTERNAL_FLASH_SPI_SLAVE_SELECT_PIN + 1, false, 0, 1) && panel_comms.base.comms_start(device);
+}
+
+static bool shared_bus_comms_stop(painter_device_t device) {
+    panel_comms.base.comms_stop(device);
+    spi_stop();
+    return true;
+}
+
+TEST_F(QPFlash, SharedBus_DrawsToSpiPanel) {
+    uint8_t          gram[QP_VIRTUAL_PANEL_BUFFER_SIZE(TEST_WIDTH, TEST_HEIGHT, 16)];
+    painter_device_t panel = qp_virtual_panel_make_device(TEST_WIDTH, TEST_HEIGHT, 16, gram);
+    ASSERT_NE(panel, nullptr);
+
+    painter_driver_t *driver          = (painter_driver_t *)panel;
+    panel_comms                       = *(const painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    shared_bus_comms                  = panel_comms;
+    shared_bus_comms.base.comms_start = shared_bus_comms_start;
+    shared_bus_comms.base.comms_stop  = shared_bus_comms_stop;
+    driver->comms_vtable              = &shared_bus_comms.base;
+    ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+
+    uint32_t image_address;
+    uint32_t font_address;
+    ASSERT_TRUE(qp_flash_asset_address(DIRECTORY_ADDRESS, 0, &font_address, NULL));
+    ASSERT_TRUE(qp_flash_asset_address(DIRECTORY_ADDRESS, 1, &image_address, NULL));
+    painter_image_handle_t flash_image = qp_load_image_flash(image_address);
+    painter_font_handle_t  flash_font  = qp_load_font_flash(font_address);
+    painter_image_handle_t mem_image   = qp_load_image_mem(image_data.data.data());
+    painter_font_handle_t  mem_font    = qp_load_font_mem(font_data.data.data());
+    ASSERT_NE(flash_image, nullptr);
+    ASSERT_NE(flash_font, nullptr);
+
+    // The panel lets go of the bus around every flash read, so drawing from flash matches drawing from memory
+    const char *str = "Flash!";
+    EXPECT_TRUE(qp_drawimage(panel, 0, 0, flash_image));
+    EXPECT_GT(qp_drawtext(panel, 2, 2, flash_font, str), 0);
+    uint32_t flash_hash = qp_virtual_panel_hash(panel);
+
+    EXPECT_TRUE(qp_rect(panel, 0, 0, TEST_WIDTH - 1, TEST_HEIGHT - 1, 0, 0, 0, true));
+    EXPECT_TRUE(qp_drawimage(panel, 0, 0, mem_image));
+    EXPECT_GT(qp_drawtext(panel, 2, 2, mem_font, str), 0);
+    EXPECT_EQ(flash_hash, qp_virtual_panel_hash(panel));
+    EXPECT_EQ(flash_spi_sim_get_stats()->nested_starts, 0u);
+
+    EXPECT_TRUE(qp_close_image(flash_image));
+    EXPECT_TRUE(qp_close_font(flash_font));
+    EXPECT_TRUE(qp_close_image(mem_image));
+    EXPECT_TRUE(qp_close_font(mem_font));
+    qp_virtual_panel_release(panel);
+}
+
+TEST_F(QPFlash, Invalid_Rejected) {
+    EXPECT_EQ(qp_load_image_flash(0), nullptr) << "Erased flash isn't an image";
+    EXPECT_EQ(qp_load_font_flash(DIRECTORY_ADDRESS), nullptr) << "A directory isn't a font";
+}
@@ -0,0 +1,173 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+#include "qp_test_assets.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_draw.h"
+#include "qp_surface_internal.h"
+}
+
+#define TEST_WIDTH 64
+#define TEST_HEIGHT 16
+
+// A status screen cycling through a handful of text colors
+static const uint8_t status_colors[][3] = {{0, 255, 255}, {85, 255, 255}, {170, 255, 255}, {43, 255, 200}, {0, 0, 255}};
+#define NUM_STATUS_COLORS (sizeof(status_colors) / sizeof(status_colors[0]))
+
+class QPPalette : public ::testing::Test {
+   protected:
+    uint8_t               rgb565_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_WIDTH, TEST_HEIGHT, 16)];
+    uint8_t               rgb888_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_WIDTH, TEST_HEIGHT, 24)];
+    uint8_t               mono_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(TEST_WIDTH, TEST_HEIGHT, 1)];
+    painter_device_t      rgb565;
+    painter_device_t      rgb888;
+    painter_device_t      mono;
+    TestFont              font_data;
+    painter_font_handle_t font;
+
+    void SetUp() override {
+        memset(surface_drivers, 0, sizeof(surface_drivers));
+        rgb565 = qp_make_rgb565_surface(TEST_WIDTH, TEST_HEIGHT, rgb565_buffer);
+        rgb888 = qp_make_rgb888_surface(TEST_WIDTH, TEST_HEIGHT, rgb888_buffer);
+        mono   = qp_make_mono1bpp_surface(TEST_WIDTH, TEST_HEIGHT, mono_buffer);
+        ASSERT_TRUE(qp_init(rgb565, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(rgb888, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(mono, QP_ROTATION_0));
+        font = qp_load_font_mem(font_data.data.data());
+        ASSERT_NE(font, nullptr);
+        qp_internal_palette_cache_clear();
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+    }
+
+    void draw_status(painter_device_t device, size_t color) {
+        const uint8_t *c = status_colors[color % NUM_STATUS_COLORS];
+        EXPECT_GT(qp_drawtext_recolor(device, 0, 0, font, "Status", c[0], c[1], c[2], 0, 0, 0), 0);
+    }
+
+    const qp_palette_cache_stats_t *stats(void) {
+        return qp_internal_palette_cache_get_stats();
+    }
+};
+
+TEST_F(QPPalette, AlternatingColors_ReuseConversions) {
+    uint8_t reference[NUM_STATUS_COLORS][sizeof(rgb565_buffer)];
+    for (size_t i = 0; i < NUM_STATUS_COLORS; ++i) {
+        draw_status(rgb565, i);
+        memcpy(reference[i], rgb565_buffer, sizeof(rgb565_buffer));
+    }
+    EXPECT_EQ(stats()->misses, NUM_STATUS_COLORS) << "Each color is converted once";
+
+    // Cycling through the colors again doesn't convert anything, and draws the same pixels
+    for (size_t round = 0; round < 4; ++round) {
+        for (size_t i = 0; i < NUM_STATUS_COLORS; ++i) {
+            draw_status(rgb565, i);
+            EXPECT_EQ(memcmp(reference[i], rgb565_buffer, sizeof(rgb565_buffer)), 0);
+        }
+    }
+    EXPECT_EQ(stats()->misses, NUM_STATUS_COLORS);
+    EXPECT_EQ(stats()->hits, 4 * NUM_STATUS_COLORS);
+
+    // Redrawing in the same color straight away is also a hit
+    draw_status(rgb565, 0);
+    draw_status(rgb565, 0);
+    EXPECT_EQ(stats()->misses, NUM_STATUS_COLORS);
+}
+
+TEST_F(QPPalette, Devices_KeptApart) {
+    // The same colors converted for different pixel formats must not be mixed up
+    draw_status(rgb565, 1);
+    draw_status(rgb888, 1);
+    draw_status(mono, 4);
+    EXPECT_EQ(stats()->misses, 3u);
+
+    for (int round = 0; round < 3; ++round) {
+        draw_status(rgb565, 1);
+        draw_status(rgb888, 1);
+        draw_status(mono, 4);
+    }
+    EXPECT_EQ(stats()->misses, 3u);
+
+    uint8_t cached565[sizeof(rgb565_buffer)];
+    uint8_t cached888[sizeof(rgb888_buffer)];
+    uint8_t cached_mono[sizeof(mono_buffer)];
+    memcpy(cached565, rgb565_buffer, sizeof(cached565));
+    memcpy(cached888, rgb888_buffer, sizeof(cached888));
+    memcpy(cached_mono, mono_buffer, sizeof(cached_mono));
+
+    // Reference output, converting from scratch for every draw
+    qp_internal_palette_cache_clear();
+    draw_status(rgb565, 1);
+    qp_internal_palette_cache_clear();
+    draw_status(rgb888, 1);
+    qp_internal_palette_cache_clear();
+    draw_status(mono, 4);
+    EXPECT_EQ(memcmp(cached565, rgb565_buffer, sizeof(cached565)), 0);
+    EXPECT_EQ(memcmp(cached888, rgb888_buffer, sizeof(cached888)), 0);
+    EXPECT_EQ(memcmp(cached_mono, mono_buffer, sizeof(cached_mono)), 0);
+}
+
+TEST_F(QPPalette, Full_EvictsLeastRecentlyUsed) {
+    qp_pixel_t bg = {.hsv888 = {.h = 0, .s = 0, .v = 0}};
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_PALETTE_CACHE_ENTRIES; ++i) {
+        qp_pixel_t fg = {.hsv888 = {.h = (uint8_t)(i * 10), .s = 255, .v = 255}};
+        EXPECT_TRUE(qp_internal_prepare_palette(rgb565, fg, bg, 4));
+    }
+
+    // Use the first palette again, so that the second becomes the oldest, then push it out
+    qp_pixel_t first  = {.hsv888 = {.h = 0, .s = 255, .v = 255}};
+    qp_pixel_t second = {.hsv888 = {.h = 10, .s = 255, .v = 255}};
+    qp_pixel_t extra  = {.hsv888 = {.h = 200, .s = 255, .v = 255}};
+    EXPECT_TRUE(qp_internal_prepare_palette(rgb565, first, bg, 4));
+    EXPECT_TRUE(qp_internal_prepare_palette(rgb565, extra, bg, 4));
+    uint32_t misses = stats()->misses;
+
+    EXPECT_TRUE(qp_internal_prepare_palette(rgb565, first, bg, 4));
+    EXPECT_EQ(stats()->misses, misses);
+    EXPECT_TRUE(qp_internal_prepare_palette(rgb565, second, bg, 4));
+    EXPECT_EQ(stats()->misses, misses + 1);
+
+    // Different palette sizes are different entries
+    EXPECT_TRUE(qp_internal_prepare_palette(rgb565, first, bg, 16));
+    EXPECT_EQ(stats()->misses, misses + 2);
+}
+
+TEST_F(QPPalette, FillPixdata_MatchesPerPixel) {
+    painter_device_t devices[] = {rgb565, rgb888, mono};
+    uint32_t         counts[]  = {1, 3, 8, 9, 37, 100000};
+    for (painter_device_t device : devices) {
+        painter_driver_t *driver = (painter_driver_t *)device;
+        for (uint32_t count : counts) {
+            memset(qp_internal_global_pixdata_buffer, 0xA5, QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE);
+            qp_internal_fill_pixdata(device, count, 85, 255, 255);
+            count = MIN(count, qp_internal_num_pixels_in_buffer(device));
+
+            // Reference, one pixel at a time
+            uint8_t    expected[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+            qp_pixel_t color       = {.hsv888 = {.h = 85, .s = 255, .v = 255}};
+            uint8_t    palette_idx = 0;
+            memset(expected, 0xA5, sizeof(expected));
+            driver->driver_vtable->palette_convert(device, 1, &color);
+            for (uint32_t i = 0; i < count; ++i) {
+                driver->driver_vtable->append_pixels(device, expected, &color, i, 1, &palette_idx);
+            }
+
+            // Whole bytes match exactly, and so do the pixels sharing the final byte
+            uint32_t bits = count * driver->native_bits_per_pixel;
+            EXPECT_EQ(memcmp(expected, qp_internal_global_pixdata_buffer, bits / 8), 0) << (int)driver->native_bits_per_pixel << "bpp, " << count << " pixels";
+            if (bits % 8) {
+                uint8_t mask = (1 << (bits % 8)) - 1;
+                EXPECT_EQ(expected[bits / 8] & mask, qp_internal_global_pixdata_buffer[bits / 8] & mask);
+            }
+        }
+    }
+}
@@ -0,0 +1,328 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <utility>
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_virtual_panel.h"
+}
+
+#define TEST_WIDTH 128
+#define TEST_HEIGHT 128
+
+typedef std::set<std::pair<int, int>> pixel_set_t;
+
+// Reference rasterizers, matching the per-pixel implementations the span batching replaced. Each returns the pixels drawn, and counts the transfers it would have made.
+static pixel_set_t reference_line(int x0, int y0, int x1, int y1, uint32_t &transfers) {
+    pixel_set_t pixels;
+    int         x = x0, y = y0;
+    int         sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+    int         dx = abs(x1 - x0), dy = -abs(y1 - y0);
+    int         e = dx + dy;
+    while (x != x1 || y != y1) {
+        pixels.insert({x, y});
+        transfers++;
+        int e2 = 2 * e;
+        if (e2 >= dy) {
+            e += dy;
+            x += sx;
+        }
+        if (e2 <= dx) {
+            e += dx;
+            y += sy;
+        }
+    }
+    pixels.insert({x, y});
+    transfers++;
+    return pixels;
+}
+
+static void reference_span(pixel_set_t &pixels, uint32_t &transfers, int l, int r, int y) {
+    for (int x = std::min(l, r); x <= std::max(l, r); ++x) {
+        pixels.insert({x, y});
+    }
+    transfers++;
+}
+
+static pixel_set_t reference_circle(int cx, int cy, int radius, bool filled, uint32_t &transfers) {
+    pixel_set_t pixels;
+    auto        helper = [&](int ox, int oy) {
+        if (ox == 0) {
+            reference_span(pixels, transfers, cx, cx, cy + oy);
+            reference_span(pixels, transfers, cx, cx, cy - oy);
+            if (filled) {
+                reference_span(pixels, transfers, cx + oy, cx - oy, cy);
+            } else {
+                reference_span(pixels, transfers, cx + oy, cx + oy, cy);
+                reference_span(pixels, transfers, cx - oy, cx - oy, cy);
+            }
+        } else if (ox == oy) {
+            for (int sy : {1, -1}) {
+                if (filled) {
+                    reference_span(pixels, transfers, cx + oy, cx - oy, cy + sy * oy);
+                } else {
+                    reference_span(pixels, transfers, cx + oy, cx + oy, cy + sy * oy);
+                    reference_span(pixels, transfers, cx - oy, cx - oy, cy + sy * oy);
+                }
+            }
+        } else if (filled) {
+            reference_span(pixels, transfers, cx + ox, cx - ox, cy + oy);
+            reference_span(pixels, transfers, cx + ox, cx - ox, cy - oy);
+            reference_span(pixels, transfers, cx + oy, cx - oy, cy + ox);
+            reference_span(pixels, transfers, cx + oy, cx - oy, cy - ox);
+        } else {
+            for (int sx : {1, -1}) {
+                for (int sy : {1, -1}) {
+                    reference_span(pixels, transfers, cx + sx * ox, cx + sx * ox, cy + sy * oy);
+                    reference_span(pixels, transfers, cx + sx * oy, cx + sx * oy, cy + sy * ox);
+                }
+            }
+        }
+    };
+
+    int x = 0, y = radius, err = ((5 - (radius >> 2)) >> 2);
+    helper(x, y);
+    while (x < y) {
+        x++;
+        if (err < 0) {
+            err += (x << 1) + 1;
+        } else {
+            y--;
+            err += ((x - y) << 1) + 1;
+        }
+        helper(x, y);
+    }
+    return pixels;
+}
+
+static pixel_set_t reference_ellipse(int cx, int cy, int sizex, int sizey, bool filled, uint32_t &transfers) {
+    pixel_set_t pixels;
+    auto        helper = [&](int ox, int oy) {
+        if (ox == 0) {
+            reference_span(pixels, transfers, cx, cx, cy + oy);
+            reference_span(pixels, transfers, cx, cx, cy - oy);
+        } else if (filled) {
+            reference_span(pixels, transfers, cx + ox, cx - ox, cy + oy);
+            if (oy > 0) {
+                reference_span(pixels, transfers, cx + ox, cx - ox, cy - oy);
+            }
+        } else {
+            for (int sx : {1, -1}) {
+                for (int sy : {1, -1}) {
+                    reference_span(pixels, transfers, cx + sx * ox, cx + sx * ox, cy + sy * oy);
+                }
+            }
+        }
+    };
+
+    int32_t aa = sizex * sizex, bb = sizey * sizey, fa = 4 * aa, fb = 4 * bb;
+    int     dx = 0, dy = sizey;
+    for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
+        helper(dx, dy);
+        if (delta >= 0) {
+            delta += fa * (1 - dy);
+            dy--;
+        }
+        delta += bb * (4 * dx + 6);
+    }
+    dx = sizex;
+    dy = 0;
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
+        helper(dx, dy);
+        if (delta >= 0) {
+            delta += fb * (1 - dx);
+            dx--;
+        }
+        delta += aa * (4 * dy + 6);
+    }
+    return pixels;
+}
+
+class QPShapes : public ::testing::Test {
+   protected:
+    uint8_t          gram[QP_VIRTUAL_PANEL_BUFFER_SIZE(TEST_WIDTH, TEST_HEIGHT, 24)];
+    painter_device_t panel;
+
+    void SetUp() override {
+        panel = qp_virtual_panel_make_device(TEST_WIDTH, TEST_HEIGHT, 24, gram);
+        ASSERT_NE(panel, nullptr);
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+        clear();
+    }
+
+    void TearDown() override {
+        qp_virtual_panel_release(panel);
+    }
+
+    void clear(void) {
+        memset(gram, 0, sizeof(gram));
+        qp_virtual_panel_reset_stats(panel);
+    }
+
+    uint8_t gray(int x, int y) {
+        return qp_virtual_panel_get_pixel(panel, x, y).g;
+    }
+
+    void expect_pixels(const pixel_set_t &expected, const char *what) {
+        int mismatches = 0;
+        for (int y = 0; y < TEST_HEIGHT; ++y) {
+            for (int x = 0; x < TEST_WIDTH; ++x) {
+                bool set = gray(x, y) != 0;
+                if (set != (expected.count({x, y}) != 0) && mismatches++ < 5) {
+                    ADD_FAILURE() << what << ": pixel " << x << "," << y << (set ? " should not" : " should") << " have been drawn";
+                }
+            }
+        }
+        EXPECT_EQ(qp_virtual_panel_get_stats(panel)->clipped_pixels, 0u);
+    }
+};
+
+TEST_F(QPShapes, Line_MatchesReference) {
+    const int lines[][4] = {{0, 0, 127, 5}, {127, 5, 0, 0}, {10, 120, 14, 3}, {64, 64, 100, 90}, {5, 60, 120, 61}, {3, 3, 40, 40}};
+    for (const auto &l : lines) {
+        uint32_t    reference_transfers = 0;
+        pixel_set_t expected            = reference_line(l[0], l[1], l[2], l[3], reference_transfers);
+
+        clear();
+        EXPECT_TRUE(qp_line(panel, l[0], l[1], l[2], l[3], 0, 0, 255));
+        expect_pixels(expected, "line");
+        EXPECT_LE(qp_virtual_panel_get_stats(panel)->windows, reference_transfers);
+    }
+}
+
+TEST_F(QPShapes, ShallowLine_OneTransferPerRun) {
+    // A gauge needle a few degrees off horizontal: 128 pixels, but only 6 rows
+    EXPECT_TRUE(qp_line(panel, 0, 0, 127, 5, 0, 0, 255));
+    EXPECT_EQ(qp_virtual_panel_get_stats(panel)->windows, 6u);
+}
+
+TEST_F(QPShapes, Circle_MatchesReference) {
+    for (int radius = 0; radius <= 60; ++radius) {
+        for (bool filled : {false, true}) {
+            uint32_t    reference_transfers = 0;
+            pixel_set_t expected            = reference_circle(64, 64, radius, filled, reference_transfers);
+
+            clear();
+            EXPECT_TRUE(qp_circle(panel, 64, 64, radius, 0, 0, 255, filled));
+            expect_pixels(expected, filled ? "filled circle" : "circle");
+            EXPECT_LE(qp_virtual_panel_get_stats(panel)->windows, reference_transfers) << "radius " << radius;
+        }
+    }
+}
+
+TEST_F(QPShapes, Ellipse_MatchesReference) {
+    const int sizes[][2] = {{1, 1}, {10, 4}, {4, 10}, {60, 20}, {20, 60}, {33, 34}};
+    for (const auto &size : sizes) {
+        for (bool filled : {false, true}) {
+            uint32_t    reference_transfers = 0;
+            pixel_set_t expected            = reference_ellipse(64, 64, size[0], size[1], filled, reference_transfers);
+
+            clear();
+            EXPECT_TRUE(qp_ellipse(panel, 64, 64, size[0], size[1], 0, 0, 255, filled));
+            expect_pixels(expected, filled ? "filled ellipse" : "ellipse");
+            EXPECT_LE(qp_virtual_panel_get_stats(panel)->windows, reference_transfers);
+        }
+    }
+}
+
+TEST_F(QPShapes, Dial_Benchmark) {
+    // Outline, filled hub and a handful of needles, as drawn by a typical round gauge
+    auto draw = [&](bool reference) {
+        uint32_t transfers = 0;
+        if (reference) {
+            reference_circle(64, 64, 60, false, transfers);
+            reference_circle(64, 64, 8, true, transfers);
+            for (int i = 0; i < 8; ++i) {
+                reference_line(64, 64, 64 + 50 * cos(i * 0.4), 64 - 50 * sin(i * 0.4), transfers);
+            }
+            return transfers;
+        }
+        EXPECT_TRUE(qp_circle(panel, 64, 64, 60, 0, 0, 255, false));
+        EXPECT_TRUE(qp_circle(panel, 64, 64, 8, 0, 0, 255, true));
+        for (int i = 0; i < 8; ++i) {
+            EXPECT_TRUE(qp_line(panel, 64, 64, 64 + 50 * cos(i * 0.4), 64 - 50 * sin(i * 0.4), 0, 0, 255));
+        }
+        return qp_virtual_panel_get_stats(panel)->windows;
+    };
+
+    uint32_t before = draw(true);
+    uint32_t after  = draw(false);
+    EXPECT_LT(after * 2, before);
+    RecordProperty("unbatched_transfers", (int)before);
+    RecordProperty("batched_transfers", (int)after);
+    RecordProperty("bus_bytes", (int)qp_virtual_panel_bus_bytes(panel));
+}
+
+TEST_F(QPShapes, LineAA_CoverageSumsToForeground) {
+    for (bool steep : {false, true}) {
+        clear();
+        uint16_t x1 = steep ? 30 : 100, y1 = steep ? 100 : 30;
+        EXPECT_TRUE(qp_line_aa(panel, 10, 10, x1, y1, 0, 0, 255, 0, 0, 0));
+
+        // Endpoints are exact
+        EXPECT_EQ(gray(10, 10), 255);
+        EXPECT_EQ(gray(x1, y1), 255);
+
+        // Each step along the major axis shares the full intensity between its pair of pixels, and nothing leaves the bounding box
+        bool partial = false;
+        for (int a = 0; a < TEST_WIDTH; ++a) {
+            int sum = 0;
+            for (int b = 0; b < TEST_HEIGHT; ++b) {
+                int value = steep ? gray(b, a) : gray(a, b);
+                int x = steep ? b : a, y = steep ? a : b;
+                if (value != 0) {
+                    EXPECT_TRUE(x >= 10 && x <= x1 && y >= 10 && y <= y1) << x << "," << y;
+                }
+                partial |= value != 0 && value != 255;
+                sum += value;
+            }
+            if (a >= 10 && a <= (steep ? y1 : x1)) {
+                EXPECT_NEAR(sum, 255, 1) << "step " << a;
+            }
+        }
+        EXPECT_TRUE(partial) << "Line should have been anti-aliased";
+        EXPECT_LE(qp_virtual_panel_get_stats(panel)->windows, 21u) << "One transfer per row or column crossed";
+    }
+}
+
+TEST_F(QPShapes, CircleAA_Symmetric) {
+    EXPECT_TRUE(qp_circle_aa(panel, 64, 64, 50, 0, 0, 255, 0, 0, 0));
+
+    EXPECT_EQ(gray(64, 14), 255);
+    EXPECT_EQ(gray(64, 114), 255);
+    EXPECT_EQ(gray(14, 64), 255);
+    EXPECT_EQ(gray(114, 64), 255);
+    EXPECT_EQ(gray(64, 13), 0) << "Nothing should be drawn outside the circle's bounding box";
+
+    bool partial = false;
+    for (int dy = 0; dy <= 51; ++dy) {
+        for (int dx = 0; dx <= 51; ++dx) {
+            uint8_t value = gray(64 + dx, 64 + dy);
+            EXPECT_EQ(gray(64 - dx, 64 + dy), value) << dx << "," << dy;
+            EXPECT_EQ(gray(64 + dx, 64 - dy), value) << dx << "," << dy;
+            EXPECT_EQ(gray(64 - dx, 64 - dy), value) << dx << "," << dy;
+            partial |= value != 0 && value != 255;
+        }
+    }
+    EXPECT_TRUE(partial) << "Circle should have been anti-aliased";
+
+    // Within the first octant each column's pair of pixels sums to full intensity
+    for (int dx = 0; dx < 30; ++dx) {
+        int sum = 0;
+        for (int dy = 40; dy <= 51; ++dy) {
+            sum += gray(64 + dx, 64 - dy);
+        }
+        EXPECT_NEAR(sum, 255, 1) << "column " << dx;
+    }
+
+    RecordProperty("transfers", (int)qp_virtual_panel_get_stats(panel)->windows);
+    RecordProperty("bus_bytes", (int)qp_virtual_panel_bus_bytes(panel));
+}
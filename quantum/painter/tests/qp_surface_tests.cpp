@@ -0,0 +1,154 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+
+extern const surface_painter_driver_vtable_t rgb565_surface_driver_vtable;
+}
+
+#define TEST_WIDTH 64
+#define TEST_HEIGHT 64
+
+// Target is itself an RGB565 surface, with viewport/pixdata wrapped so that transfers can be counted
+static uint32_t target_viewports;
+static uint32_t target_pixels;
+
+static bool counting_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    target_viewports++;
+    return rgb565_surface_driver_vtable.base.viewport(device, left, top, right, bottom);
+}
+
+static bool counting_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    target_pixels += native_pixel_count;
+    return rgb565_surface_driver_vtable.base.pixdata(device, pixel_data, native_pixel_count);
+}
+
+static painter_driver_vtable_t counting_vtable;
+
+class QPSurface : public ::testing::Test {
+   protected:
+    uint16_t                 surface_buffer[TEST_WIDTH * TEST_HEIGHT];
+    uint16_t                 target_buffer[TEST_WIDTH * TEST_HEIGHT];
+    surface_painter_device_t target_table[1];
+    painter_device_t         surface;
+    painter_device_t         target;
+
+    void SetUp() override {
+        memset(surface_drivers, 0, sizeof(surface_drivers));
+        memset(target_table, 0, sizeof(target_table));
+
+        surface = qp_make_rgb565_surface(TEST_WIDTH, TEST_HEIGHT, surface_buffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        counting_vtable          = rgb565_surface_driver_vtable.base;
+        counting_vtable.viewport = counting_viewport;
+        counting_vtable.pixdata  = counting_pixdata;
+        target                   = qp_make_rgb565_surface_advanced(target_table, 1, TEST_WIDTH, TEST_HEIGHT, target_buffer);
+        ASSERT_TRUE(qp_init(target, QP_ROTATION_0));
+        target_table[0].base.driver_vtable = &counting_vtable;
+
+        // Start from a clean, fully synchronised state
+        ASSERT_TRUE(qp_surface_draw(surface, target, 0, 0, true));
+        reset_counters();
+    }
+
+    void reset_counters(void) {
+        target_viewports = 0;
+        target_pixels    = 0;
+    }
+
+    void expect_in_sync(void) {
+        EXPECT_EQ(memcmp(surface_buffer, target_buffer, sizeof(surface_buffer)), 0) << "Target should match the surface";
+    }
+
+    const surface_dirty_data_t &dirty(void) {
+        return ((surface_painter_device_t *)surface)->dirty;
+    }
+};
+
+TEST_F(QPSurface, DisjointCorners_SeparateRegions) {
+    // A clock in one corner and a layer indicator in the opposite one
+    EXPECT_TRUE(qp_rect(surface, 0, 0, 9, 4, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(surface, 54, 59, 63, 63, 85, 255, 255, true));
+    EXPECT_EQ(dirty().rect_count, 2);
+
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+    EXPECT_EQ(target_viewports, 2u);
+    EXPECT_EQ(target_pixels, 2u * 10 * 5) << "Only the two dirty rectangles should have been transferred";
+    expect_in_sync();
+}
+
+TEST_F(QPSurface, FilledRect_SingleRegion) {
+    EXPECT_TRUE(qp_rect(surface, 10, 12, 41, 29, 170, 255, 255, true));
+    EXPECT_EQ(dirty().rect_count, 1) << "Row-by-row fill should coalesce into one rectangle";
+
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+    EXPECT_EQ(target_viewports, 1u);
+    EXPECT_EQ(target_pixels, 32u * 18);
+    expect_in_sync();
+}
+
+TEST_F(QPSurface, NearbyUpdates_Merged) {
+    EXPECT_TRUE(qp_rect(surface, 20, 20, 27, 27, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(surface, 29, 20, 36, 27, 0, 255, 255, true));
+    EXPECT_EQ(dirty().rect_count, 1) << "Rectangles separated by a single column should be merged";
+
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+    EXPECT_EQ(target_viewports, 1u);
+    EXPECT_EQ(target_pixels, 17u * 8);
+    expect_in_sync();
+}
+
+TEST_F(QPSurface, MoreRegionsThanSlots_AllTransferred) {
+    // Far apart in both directions so that each starts out as its own rectangle
+    for (int i = 0; i < SURFACE_NUM_DIRTY_RECTS + 2; ++i) {
+        uint16_t x = (i % 4) * 16;
+        uint16_t y = (i / 4) * 32 + (i % 4) * 8;
+        EXPECT_TRUE(qp_rect(surface, x, y, x + 2, y + 2, i * 40, 255, 255, true));
+        EXPECT_LE(dirty().rect_count, SURFACE_NUM_DIRTY_RECTS);
+    }
+
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+    EXPECT_LE(target_viewports, (uint32_t)SURFACE_NUM_DIRTY_RECTS);
+    EXPECT_LT(target_pixels, (uint32_t)(TEST_WIDTH * TEST_HEIGHT)) << "Should not have fallen back to the whole surface";
+    expect_in_sync();
+}
+
+TEST_F(QPSurface, ScatteredPixels_SingleRegion) {
+    // Close enough together that separate regions would cost more than the gaps between them
+    for (int y = 0; y < 16; y += 5) {
+        for (int x = 0; x < 16; x += 5) {
+            EXPECT_TRUE(qp_setpixel(surface, x, y, 0, 255, 255));
+        }
+    }
+
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+    EXPECT_EQ(target_viewports, 1u);
+    EXPECT_EQ(target_pixels, 16u * 16);
+    expect_in_sync();
+}
+
+TEST_F(QPSurface, UnchangedPixels_NotDirty) {
+    EXPECT_TRUE(qp_rect(surface, 0, 0, 7, 7, 0, 0, 0, true));
+    EXPECT_FALSE(dirty().is_dirty) << "Redrawing identical pixels should not mark anything dirty";
+
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, false));
+    EXPECT_EQ(target_viewports, 0u);
+    EXPECT_EQ(target_pixels, 0u);
+}
+
+TEST_F(QPSurface, EntireSurface_IgnoresDirtyRegions) {
+    EXPECT_TRUE(qp_rect(surface, 0, 0, 3, 3, 0, 255, 255, true));
+    EXPECT_TRUE(qp_surface_draw(surface, target, 0, 0, true));
+    EXPECT_EQ(target_viewports, 1u);
+    EXPECT_EQ(target_pixels, (uint32_t)(TEST_WIDTH * TEST_HEIGHT));
+    EXPECT_EQ(dirty().rect_count, 0) << "Dirty regions should have been reset";
+    expect_in_sync();
+}
@@ -0,0 +1,149 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+extern "C" {
+#include "qp.h"
+#include "qgf.h"
+#include "qff.h"
+}
+
+#define FONT_HEIGHT 8
+
+// Little-endian block writer shared by the QGF and QFF builders
+class TestAsset {
+   public:
+    std::vector<uint8_t> data;
+
+   protected:
+    void push_header(uint8_t type_id, uint32_t length) {
+        data.push_back(type_id);
+        data.push_back(~type_id);
+        push_u24(length);
+    }
+    void push_u16(uint32_t v) {
+        data.push_back(v & 0xFF);
+        data.push_back((v >> 8) & 0xFF);
+    }
+    void push_u24(uint32_t v) {
+        push_u16(v);
+        data.push_back((v >> 16) & 0xFF);
+    }
+    void push_u32(uint32_t v) {
+        push_u24(v);
+        data.push_back(v >> 24);
+    }
+};
+
+// Builds an uncompressed 1bpp QFF font with an ascii table, where each glyph has a distinct pattern
+class TestFont : public TestAsset {
+   public:
+    TestFont() {
+        std::vector<uint8_t> glyphs;
+        std::vector<uint8_t> table;
+        for (int c = 0x20; c < 0x7F; ++c) {
+            uint32_t value = (glyphs.size() << QFF_GLYPH_WIDTH_BITS) | glyph_width(c);
+            table.push_back(value & 0xFF);
+            table.push_back((value >> 8) & 0xFF);
+            table.push_back((value >> 16) & 0xFF);
+            for (int i = 0; i < glyph_width(c); ++i) {
+                glyphs.push_back((uint8_t)(c * 37 + i * 91));
+            }
+        }
+
+        uint32_t total = sizeof(qff_font_descriptor_v1_t) + sizeof(qff_ascii_glyph_table_v1_t) + sizeof(qgf_block_header_v1_t) + glyphs.size();
+        push_header(QFF_FONT_DESCRIPTOR_TYPEID, sizeof(qff_font_descriptor_v1_t) - sizeof(qgf_block_header_v1_t));
+        push_u24(QFF_MAGIC);
+        data.push_back(0x01);
+        push_u32(total);
+        push_u32(~total);
+        data.push_back(FONT_HEIGHT);
+        data.push_back(1); // has_ascii_table
+        data.push_back(0); // num_unicode_glyphs
+        data.push_back(0);
+        data.push_back(GRAYSCALE_1BPP);
+        data.push_back(0); // flags
+        data.push_back(IMAGE_UNCOMPRESSED);
+        data.push_back(0); // transparency_index
+
+        push_header(QFF_ASCII_GLYPH_DESCRIPTOR_TYPEID, table.size());
+        data.insert(data.end(), table.begin(), table.end());
+
+        push_header(QGF_FRAME_DATA_DESCRIPTOR_TYPEID, glyphs.size());
+        glyph_data = data.size();
+        data.insert(data.end(), glyphs.begin(), glyphs.end());
+    }
+
+    static int glyph_width(int c) {
+        return 3 + (c % 3);
+    }
+
+    // Whether the glyph's pixel is set, as laid out in the font
+    bool pixel(int c, int x, int y) const {
+        uint32_t offset = 0;
+        for (int i = 0x20; i < c; ++i) {
+            offset += glyph_width(i);
+        }
+        uint32_t bit = y * glyph_width(c) + x;
+        return data[glyph_data + offset + bit / 8] & (1 << (bit % 8));
+    }
+
+    // Changes every glyph's pattern in place
+    void mutate(void) {
+        for (size_t i = glyph_data; i < data.size(); ++i) {
+            data[i] ^= 0xFF;
+        }
+    }
+
+    size_t glyph_data;
+};
+
+// Builds a single frame, uncompressed 4bpp palette QGF image of diagonal bands, one palette entry per hue
+class TestImage : public TestAsset {
+   public:
+    TestImage(uint16_t width, uint16_t height) {
+        std::vector<uint8_t> pixels((width * height + 1) / 2);
+        for (uint32_t i = 0; i < (uint32_t)width * height; ++i) {
+            pixels[i / 2] |= index(i % width, i / width) << ((i % 2) * 4);
+        }
+
+        uint32_t frame_offset = sizeof(qgf_graphics_descriptor_v1_t) + sizeof(qgf_frame_offsets_v1_t) + sizeof(uint32_t);
+        uint32_t total        = frame_offset + sizeof(qgf_frame_v1_t) + sizeof(qgf_palette_v1_t) + 16 * sizeof(qgf_palette_entry_v1_t) + sizeof(qgf_data_v1_t) + pixels.size();
+        push_header(QGF_GRAPHICS_DESCRIPTOR_TYPEID, sizeof(qgf_graphics_descriptor_v1_t) - sizeof(qgf_block_header_v1_t));
+        push_u24(QGF_MAGIC);
+        data.push_back(0x01);
+        push_u32(total);
+        push_u32(~total);
+        push_u16(width);
+        push_u16(height);
+        push_u16(1); // frame_count
+
+        push_header(QGF_FRAME_OFFSET_DESCRIPTOR_TYPEID, sizeof(uint32_t));
+        push_u32(frame_offset);
+
+        push_header(QGF_FRAME_DESCRIPTOR_TYPEID, sizeof(qgf_frame_v1_t) - sizeof(qgf_block_header_v1_t));
+        data.push_back(PALETTE_4BPP);
+        data.push_back(0); // flags
+        data.push_back(IMAGE_UNCOMPRESSED);
+        data.push_back(0); // transparency_index
+        push_u16(0);       // delay
+
+        push_header(QGF_FRAME_PALETTE_DESCRIPTOR_TYPEID, 16 * sizeof(qgf_palette_entry_v1_t));
+        for (int i = 0; i < 16; ++i) {
+            data.push_back(i * 16);
+            data.push_back(255);
+            data.push_back(255);
+        }
+
+        push_header(QGF_FRAME_DATA_DESCRIPTOR_TYPEID, pixels.size());
+        data.insert(data.end(), pixels.begin(), pixels.end());
+    }
+
+    static uint8_t index(uint16_t x, uint16_t y) {
+        return ((x + y) / 4) % 16;
+    }
+};
@@ -0,0 +1,137 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "qp_test_assets.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+
+extern const surface_painter_driver_vtable_t rgb565_surface_driver_vtable;
+}
+
+#define TEST_WIDTH 96
+#define TEST_HEIGHT 16
+
+// Surface vtable with viewport wrapped, so that the number of blits can be counted
+static uint32_t viewport_calls;
+
+static bool counting_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    viewport_calls++;
+    return rgb565_surface_driver_vtable.base.viewport(device, left, top, right, bottom);
+}
+
+static painter_driver_vtable_t counting_vtable;
+
+class QPText : public ::testing::Test {
+   protected:
+    uint16_t              buffer[TEST_WIDTH * TEST_HEIGHT];
+    painter_device_t      surface;
+    TestFont              font_data;
+    painter_font_handle_t font;
+
+    void SetUp() override {
+        memset(surface_drivers, 0, sizeof(surface_drivers));
+        surface = qp_make_rgb565_surface(TEST_WIDTH, TEST_HEIGHT, buffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        counting_vtable                                          = rgb565_surface_driver_vtable.base;
+        counting_vtable.viewport                                 = counting_viewport;
+        ((surface_painter_device_t *)surface)->base.driver_vtable = &counting_vtable;
+        viewport_calls                                           = 0;
+
+        font = qp_load_font_mem(font_data.data.data());
+        ASSERT_NE(font, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+    }
+
+    // Checks the rendered text against a reference font; set pixels are white, unset ones black
+    void expect_text(const TestFont &reference, uint16_t x, uint16_t y, const std::string &str) {
+        for (char c : str) {
+            for (int gy = 0; gy < FONT_HEIGHT; ++gy) {
+                for (int gx = 0; gx < TestFont::glyph_width(c); ++gx) {
+                    uint16_t expected = reference.pixel(c, gx, gy) ? 0xFFFF : 0x0000;
+                    ASSERT_EQ(buffer[(y + gy) * TEST_WIDTH + x + gx], expected) << "glyph '" << c << "' at " << gx << "," << gy;
+                }
+            }
+            x += TestFont::glyph_width(c);
+        }
+    }
+
+    int16_t expected_width(const std::string &str) {
+        int16_t width = 0;
+        for (char c : str) {
+            width += TestFont::glyph_width(c);
+        }
+        return width;
+    }
+};
+
+TEST_F(QPText, DrawText_MatchesFont) {
+    EXPECT_EQ(qp_drawtext(surface, 2, 3, font, "WPM 123"), expected_width("WPM 123"));
+    expect_text(font_data, 2, 3, "WPM 123");
+}
+
+TEST_F(QPText, RepeatedText_DrawnFromCache) {
+    TestFont original = font_data;
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, "abc"), expected_width("abc"));
+
+    // Glyphs already decoded must not be re-read from the font
+    font_data.mutate();
+    viewport_calls = 0;
+    EXPECT_EQ(qp_drawtext(surface, 0, 8, font, "cab"), expected_width("cab"));
+    expect_text(original, 0, 8, "cab");
+    EXPECT_EQ(viewport_calls, 3u) << "Each cached glyph should be a single blit";
+
+    // Different colors are decoded afresh
+    EXPECT_EQ(qp_drawtext_recolor(surface, 0, 0, font, "a", 0, 0, 254, 0, 0, 0), expected_width("a"));
+    EXPECT_NE(memcmp(&buffer[0], &buffer[8 * TEST_WIDTH + TestFont::glyph_width('c')], TestFont::glyph_width('a') * sizeof(uint16_t)), 0);
+}
+
+TEST_F(QPText, CloseFont_InvalidatesCache) {
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, "xyz"), expected_width("xyz"));
+    font_data.mutate();
+    ASSERT_TRUE(qp_close_font(font));
+    font = qp_load_font_mem(font_data.data.data());
+    ASSERT_NE(font, nullptr);
+
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, "xyz"), expected_width("xyz"));
+    expect_text(font_data, 0, 0, "xyz");
+}
+
+TEST_F(QPText, MoreGlyphsThanCache_Evicted) {
+    // Far more glyph data than fits in the cache, drawn repeatedly to exercise eviction and compaction
+    const std::string line = "The quick brown fox";
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(qp_drawtext(surface, i, i * 4, font, line.c_str()), expected_width(line));
+        expect_text(font_data, i, i * 4, line);
+    }
+}
+
+TEST_F(QPText, TextRun_SingleBlit) {
+    painter_text_run_handle_t run = qp_make_text_run(surface, font, "Layer 2", 0, 0, 255, 0, 0, 0);
+    ASSERT_NE(run, nullptr);
+    EXPECT_EQ(run->width, expected_width("Layer 2"));
+    EXPECT_EQ(run->height, FONT_HEIGHT);
+
+    // The run is independent of the font once rendered
+    TestFont original = font_data;
+    font_data.mutate();
+    viewport_calls = 0;
+    EXPECT_EQ(qp_drawtext_run(surface, 5, 7, run), expected_width("Layer 2"));
+    EXPECT_EQ(viewport_calls, 1u) << "Text run should be sent as a single block";
+    expect_text(original, 5, 7, "Layer 2");
+
+    EXPECT_TRUE(qp_close_text_run(run));
+    EXPECT_FALSE(qp_close_text_run(run));
+    EXPECT_EQ(qp_drawtext_run(surface, 5, 7, run), 0);
+}
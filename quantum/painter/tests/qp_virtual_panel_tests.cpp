@@ -0,0 +1,220 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "qp_test_assets.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+#include "qp_virtual_panel.h"
+}
+
+#define TEST_WIDTH 80
+#define TEST_HEIGHT 48
+#define MAX_GRAM_SIZE QP_VIRTUAL_PANEL_BUFFER_SIZE(TEST_WIDTH, TEST_HEIGHT, 24)
+
+class QPVirtualPanel : public ::testing::TestWithParam<int> {
+   protected:
+    uint8_t          gram[MAX_GRAM_SIZE];
+    uint8_t          surface_buffer[MAX_GRAM_SIZE];
+    painter_device_t panel;
+    painter_device_t surface;
+    TestFont         font_data;
+    TestImage        image_data{32, 24};
+
+    void SetUp() override {
+        memset(surface_drivers, 0, sizeof(surface_drivers));
+        memset(surface_buffer, 0, sizeof(surface_buffer));
+
+        panel = qp_virtual_panel_make_device(TEST_WIDTH, TEST_HEIGHT, bpp(), gram);
+        ASSERT_NE(panel, nullptr);
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+        surface = bpp() == 16 ? qp_make_rgb565_surface(TEST_WIDTH, TEST_HEIGHT, surface_buffer) : qp_make_rgb888_surface(TEST_WIDTH, TEST_HEIGHT, surface_buffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        qp_virtual_panel_reset_stats(panel);
+    }
+
+    void TearDown() override {
+        qp_virtual_panel_release(panel);
+    }
+
+    int bpp(void) const {
+        return GetParam();
+    }
+
+    uint32_t gram_size(void) const {
+        return QP_VIRTUAL_PANEL_BUFFER_SIZE(TEST_WIDTH, TEST_HEIGHT, bpp());
+    }
+
+    // A bit of everything, so that each drawing routine is covered by the comparisons
+    void draw_scene(painter_device_t device) {
+        painter_image_handle_t image = qp_load_image_mem(image_data.data.data());
+        painter_font_handle_t  font  = qp_load_font_mem(font_data.data.data());
+        ASSERT_NE(image, nullptr);
+        ASSERT_NE(font, nullptr);
+
+        EXPECT_TRUE(qp_rect(device, 0, 0, TEST_WIDTH - 1, TEST_HEIGHT - 1, 170, 255, 64, true));
+        EXPECT_TRUE(qp_drawimage(device, 4, 4, image));
+        EXPECT_TRUE(qp_rect(device, 40, 4, 75, 20, 85, 255, 255, false));
+        EXPECT_TRUE(qp_line(device, 40, 22, 75, 30, 0, 0, 255));
+        EXPECT_TRUE(qp_circle(device, 56, 12, 6, 0, 255, 255, true));
+        EXPECT_TRUE(qp_ellipse(device, 20, 38, 14, 6, 43, 255, 255, false));
+        EXPECT_GT(qp_drawtext(device, 40, 36, font, "QMK 42"), 0);
+
+        EXPECT_TRUE(qp_close_font(font));
+        EXPECT_TRUE(qp_close_image(image));
+    }
+};
+
+TEST_P(QPVirtualPanel, FilledRect_CountsBusBytes) {
+    EXPECT_TRUE(qp_rect(panel, 10, 12, 19, 21, 0, 255, 255, true));
+
+    const qp_virtual_panel_stats_t *stats = qp_virtual_panel_get_stats(panel);
+    EXPECT_EQ(stats->windows, 1u);
+    EXPECT_EQ(stats->commands, 3u) << "Column address, row address and memory write";
+    EXPECT_EQ(stats->data_bytes, 8u + 100u * bpp() / 8);
+    EXPECT_EQ(stats->pixels, 100u);
+    EXPECT_EQ(stats->clipped_pixels, 0u);
+    EXPECT_EQ(qp_virtual_panel_bus_bytes(panel), stats->commands + stats->data_bytes);
+
+    rgb_t inside  = qp_virtual_panel_get_pixel(panel, 10, 12);
+    rgb_t outside = qp_virtual_panel_get_pixel(panel, 9, 12);
+    EXPECT_EQ(inside.r, 255);
+    EXPECT_EQ(inside.g, 0);
+    EXPECT_EQ(inside.b, 0);
+    EXPECT_EQ(outside.r | outside.g | outside.b, 0);
+}
+
+TEST_P(QPVirtualPanel, Rotation_MapsToPhysicalOrigin) {
+    // Logical (0,0) ends up in a different physical corner for each rotation
+    const struct {
+        painter_rotation_t rotation;
+        uint16_t           x;
+        uint16_t           y;
+    } cases[] = {
+        {QP_ROTATION_0, 0, 0},
+        {QP_ROTATION_90, TEST_WIDTH - 1, 0},
+        {QP_ROTATION_180, TEST_WIDTH - 1, TEST_HEIGHT - 1},
+        {QP_ROTATION_270, 0, TEST_HEIGHT - 1},
+    };
+    for (const auto &c : cases) {
+        ASSERT_TRUE(qp_init(panel, c.rotation));
+        EXPECT_TRUE(qp_setpixel(panel, 0, 0, 0, 0, 255));
+        EXPECT_EQ(qp_virtual_panel_get_pixel(panel, c.x, c.y).g, 255) << "rotation " << c.rotation;
+    }
+    EXPECT_EQ(qp_virtual_panel_get_stats(panel)->clipped_pixels, 0u);
+}
+
+TEST_P(QPVirtualPanel, Scene_MatchesSurface) {
+    draw_scene(panel);
+    draw_scene(surface);
+    EXPECT_EQ(memcmp(gram, surface_buffer, gram_size()), 0) << "Panel and surface should hold identical pixels";
+    EXPECT_EQ(qp_virtual_panel_get_stats(panel)->clipped_pixels, 0u);
+}
+
+TEST_P(QPVirtualPanel, SurfaceFlush_TransfersDirtyRegionsOnly) {
+    EXPECT_TRUE(qp_surface_draw(surface, panel, 0, 0, true));
+    qp_virtual_panel_reset_stats(panel);
+
+    EXPECT_TRUE(qp_rect(surface, 0, 0, 9, 4, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(surface, 70, 43, 79, 47, 85, 255, 255, true));
+    EXPECT_TRUE(qp_surface_draw(surface, panel, 0, 0, false));
+
+    const qp_virtual_panel_stats_t *stats = qp_virtual_panel_get_stats(panel);
+    EXPECT_EQ(stats->windows, 2u);
+    EXPECT_EQ(stats->pixels, 2u * 10 * 5);
+    EXPECT_EQ(stats->data_bytes, 2u * 8 + stats->pixels * bpp() / 8);
+    EXPECT_EQ(memcmp(gram, surface_buffer, gram_size()), 0);
+}
+
+TEST_P(QPVirtualPanel, WritePpm_DumpsFrame) {
+    EXPECT_TRUE(qp_rect(panel, 0, 0, 0, 0, 0, 0, 255, true));
+
+    std::string filename = ::testing::TempDir() + "qp_virtual_panel_" + std::to_string(bpp()) + ".ppm";
+    ASSERT_TRUE(qp_virtual_panel_write_ppm(panel, filename.c_str()));
+
+    std::ifstream file(filename, std::ios::binary);
+    std::string   magic;
+    int           width, height, maxval;
+    file >> magic >> width >> height >> maxval;
+    file.get();
+    EXPECT_EQ(magic, "P6");
+    EXPECT_EQ(width, TEST_WIDTH);
+    EXPECT_EQ(height, TEST_HEIGHT);
+    EXPECT_EQ(maxval, 255);
+
+    std::string pixels((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    ASSERT_EQ(pixels.size(), (size_t)(TEST_WIDTH * TEST_HEIGHT * 3));
+    EXPECT_EQ(pixels.substr(0, 6), std::string("\xFF\xFF\xFF\x00\x00\x00", 6));
+    std::remove(filename.c_str());
+}
+
+TEST_P(QPVirtualPanel, BusTraffic) {
+    // Bus traffic for common operations, recorded in the test report so it can be compared across changes
+    auto record = [&](const char *name) {
+        EXPECT_GT(qp_virtual_panel_bus_bytes(panel), 0u);
+        RecordProperty(std::string(name) + "_bus_bytes", (int)qp_virtual_panel_bus_bytes(panel));
+        RecordProperty(std::string(name) + "_windows", (int)qp_virtual_panel_get_stats(panel)->windows);
+        qp_virtual_panel_reset_stats(panel);
+    };
+
+    painter_image_handle_t image = qp_load_image_mem(image_data.data.data());
+    painter_font_handle_t  font  = qp_load_font_mem(font_data.data.data());
+    ASSERT_NE(image, nullptr);
+    ASSERT_NE(font, nullptr);
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(qp_drawimage(panel, i % 8, i % 8, image));
+    }
+    record("drawimage");
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_GT(qp_drawtext(panel, 0, i % 40, font, "The quick brown fox"), 0);
+    }
+    record("drawtext");
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(qp_rect(surface, i % 70, i % 40, i % 70 + 9, i % 40 + 7, i, 255, 255, true));
+        EXPECT_TRUE(qp_surface_draw(surface, panel, 0, 0, false));
+    }
+    record("surface_flush");
+
+    EXPECT_TRUE(qp_close_font(font));
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+INSTANTIATE_TEST_CASE_P(Formats, QPVirtualPanel, ::testing::Values(16, 24));
+
+// Golden output for the reference scene; update deliberately whenever rendering changes
+TEST(QPVirtualPanelGolden, Scene_Hash) {
+    static uint8_t gram[MAX_GRAM_SIZE];
+    TestFont       font_data;
+    TestImage      image_data{32, 24};
+
+    painter_device_t panel = qp_virtual_panel_make_device(TEST_WIDTH, TEST_HEIGHT, 16, gram);
+    ASSERT_NE(panel, nullptr);
+    ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+
+    painter_image_handle_t image = qp_load_image_mem(image_data.data.data());
+    painter_font_handle_t  font  = qp_load_font_mem(font_data.data.data());
+    EXPECT_TRUE(qp_rect(panel, 0, 0, TEST_WIDTH - 1, TEST_HEIGHT - 1, 170, 255, 64, true));
+    EXPECT_TRUE(qp_drawimage(panel, 4, 4, image));
+    EXPECT_TRUE(qp_rect(panel, 40, 4, 75, 20, 85, 255, 255, false));
+    EXPECT_GT(qp_drawtext(panel, 40, 36, font, "QMK 42"), 0);
+    qp_close_font(font);
+    qp_close_image(image);
+
+    rgb_t image_origin = qp_virtual_panel_get_pixel(panel, 4, 4);
+    EXPECT_EQ(image_origin.r, 255) << "First palette entry is red";
+    EXPECT_EQ(image_origin.g | image_origin.b, 0);
+    EXPECT_EQ(qp_virtual_panel_hash(panel), 0xA866890Du);
+    qp_virtual_panel_release(panel);
+}
@@ -0,0 +1,141 @@
+qp_common_DEFS := \
+	-DQUANTUM_PAINTER_ENABLE \
+	-DQUANTUM_PAINTER_SURFACE_ENABLE \
+	-DQUANTUM_PAINTER_DUMMY_COMMS_ENABLE \
+	-DNO_PRINT \
+	-DNO_DEBUG
+qp_common_INC := \
+	$(QUANTUM_PATH)/painter \
+	$(QUANTUM_PATH)/unicode \
+	$(DRIVER_PATH)/painter/generic \
+	$(DRIVER_PATH)/painter/comms
+qp_common_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(QUANTUM_PATH)/deferred_exec.c \
+	$(QUANTUM_PATH)/color.c \
+	$(QUANTUM_PATH)/unicode/utf8.c \
+	$(QUANTUM_PATH)/painter/qp.c \
+	$(QUANTUM_PATH)/painter/qp_stream.c \
+	$(QUANTUM_PATH)/painter/qgf.c \
+	$(QUANTUM_PATH)/painter/qff.c \
+	$(QUANTUM_PATH)/painter/qp_draw_core.c \
+	$(QUANTUM_PATH)/painter/qp_draw_codec.c \
+	$(QUANTUM_PATH)/painter/qp_draw_circle.c \
+	$(QUANTUM_PATH)/painter/qp_draw_ellipse.c \
+	$(QUANTUM_PATH)/painter/qp_draw_image.c \
+	$(QUANTUM_PATH)/painter/qp_draw_text.c \
+	$(QUANTUM_PATH)/painter/qp_comms.c \
+	$(DRIVER_PATH)/painter/comms/qp_comms_dummy.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_common.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_compose.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_mono1bpp.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
+	$(DRIVER_PATH)/painter/generic/qp_surface_rgb888.c
+
+qp_surface_DEFS := \
+	$(qp_common_DEFS) \
+	-DSURFACE_NUM_DEVICES=2 \
+	-DSURFACE_NUM_DIRTY_RECTS=4
+qp_surface_INC := \
+	$(qp_common_INC)
+qp_surface_SRC := \
+	$(qp_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/qp_surface_tests.cpp
+
+qp_text_DEFS := \
+	$(qp_common_DEFS) \
+	-DSURFACE_NUM_DEVICES=1 \
+	-DQUANTUM_PAINTER_GLYPH_CACHE_SIZE=256 \
+	-DQUANTUM_PAINTER_GLYPH_CACHE_ENTRIES=8 \
+	-DQUANTUM_PAINTER_NUM_TEXT_RUNS=2
+qp_text_INC := \
+	$(qp_common_INC)
+qp_text_SRC := \
+	$(qp_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/qp_text_tests.cpp
+
+qp_codec_DEFS := \
+	$(qp_common_DEFS) \
+	-DSURFACE_NUM_DEVICES=2 \
+	-DQUANTUM_PAINTER_SUPPORTS_256_PALETTE=1 \
+	-DQUANTUM_PAINTER_SUPPORTS_LZ=1
+qp_codec_INC := \
+	$(qp_common_INC)
+qp_codec_SRC := \
+	$(qp_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/qp_codec_tests.cpp
+
+qp_virtual_panel_DEFS := \
+	$(qp_common_DEFS) \
+	-DSURFACE_NUM_DEVICES=2
+qp_virtual_panel_INC := \
+	$(qp_common_INC) \
+	$(DRIVER_PATH)/painter/tft_panel \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers
+qp_virtual_panel_SRC := \
+	$(qp_common_SRC) \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/qp_virtual_panel.c \
+	$(QUANTUM_PATH)/painter/tests/qp_virtual_panel_tests.cpp
+
+qp_shapes_DEFS := \
+	$(qp_common_DEFS)
+qp_shapes_INC := \
+	$(qp_virtual_panel_INC)
+qp_shapes_SRC := \
+	$(qp_common_SRC) \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/qp_virtual_panel.c \
+	$(QUANTUM_PATH)/painter/tests/qp_shapes_tests.cpp
+
+qp_display_list_DEFS := \
+	$(qp_common_DEFS) \
+	-DSURFACE_NUM_DEVICES=3 \
+	-DQUANTUM_PAINTER_DISPLAY_LIST_ENABLE
+qp_display_list_INC := \
+	$(qp_virtual_panel_INC)
+qp_display_list_SRC := \
+	$(qp_common_SRC) \
+	$(QUANTUM_PATH)/painter/qp_display_list.c \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/qp_virtual_panel.c \
+	$(QUANTUM_PATH)/painter/tests/qp_display_list_tests.cpp
+
+qp_compose_DEFS := \
+	$(qp_common_DEFS) \
+	-DSURFACE_NUM_DEVICES=5
+qp_compose_INC := \
+	$(qp_virtual_panel_INC)
+qp_compose_SRC := \
+	$(qp_common_SRC) \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/qp_virtual_panel.c \
+	$(QUANTUM_PATH)/painter/tests/qp_compose_tests.cpp
+
+qp_flash_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/flash_spi_tests_config.h
+qp_flash_DEFS := \
+	$(qp_common_DEFS) \
+	-DSURFACE_NUM_DEVICES=2 \
+	-DQUANTUM_PAINTER_FLASH_ENABLE
+qp_flash_INC := \
+	$(qp_virtual_panel_INC) \
+	$(DRIVER_PATH)/flash
+qp_flash_SRC := \
+	$(qp_common_SRC) \
+	$(QUANTUM_PATH)/painter/qp_flash_assets.c \
+	$(DRIVER_PATH)/flash/flash_spi.c \
+	$(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/flash_spi_sim.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/qp_virtual_panel.c \
+	$(QUANTUM_PATH)/painter/tests/qp_flash_tests.cpp
+
+qp_palette_DEFS := \
+	$(qp_common_DEFS) \
+	-DSURFACE_NUM_DEVICES=3 \
+	-DQUANTUM_PAINTER_PALETTE_CACHE_ENTRIES=6
+qp_palette_INC := \
+	$(qp_common_INC)
+qp_palette_SRC := \
+	$(qp_common_SRC) \
+	$(QUANTUM_PATH)/painter/tests/qp_palette_tests.cpp
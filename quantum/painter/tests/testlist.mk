@@ -0,0 +1,10 @@
+TEST_LIST += \
+	qp_surface \
+	qp_text \
+	qp_codec \
+	qp_virtual_panel \
+	qp_shapes \
+	qp_display_list \
+	qp_compose \
+	qp_flash \
+	qp_palette
@@ -93,6 +93,10 @@
 #    include "process_oneshot.h"
 #endif
 
+#ifdef EEPROM_DRIVER
+#    include "eeprom_driver.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -233,6 +237,13 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#ifdef EECONFIG_RAM_CACHE
+    eeconfig_flush();
+#endif
+#ifdef EEPROM_DRIVER
+    // Make sure any deferred writes land before the MCU resets
+    eeprom_driver_flush();
+#endif
 }
 
 void reset_keyboard(void) {
@@ -531,6 +542,13 @@ void suspend_power_down_quantum(void) {
     pointing_device_task();
 #    endif
 #endif
+#ifdef EECONFIG_RAM_CACHE
+    eeconfig_flush();
+#endif
+#ifdef EEPROM_DRIVER
+    // Power may be cut while suspended, so don't hold on to deferred writes
+    eeprom_driver_flush();
+#endif
 }
 
 __attribute__((weak)) void suspend_wakeup_init_quantum(void) {
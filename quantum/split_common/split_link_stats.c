@@ -0,0 +1,194 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef SPLIT_LINK_STATS_ENABLE
+
+#    include <inttypes.h>
+#    include <string.h>
+
+#    include "split_link_stats.h"
+#    include "transport.h"
+#    ifdef SPLIT_COMMON_TRANSACTIONS
+#        include "transactions.h"
+#    endif
+#    include "keyboard.h"
+#    include "timer.h"
+#    include "print.h"
+
+#    if defined(PROTOCOL_CHIBIOS)
+#        include <ch.h>
+#    endif
+
+static split_link_stats_t split_link_stats;
+
+////////////////////////////////////////////////////
+// Timing
+
+#    if defined(PROTOCOL_CHIBIOS)
+uint32_t split_link_stats_timestamp(void) {
+    return (uint32_t)chVTGetSystemTimeX();
+}
+
+static uint32_t split_link_stats_elapsed_us(uint32_t start) {
+    return (uint32_t)TIME_I2US(chVTTimeElapsedSinceX((systime_t)start));
+}
+#    else
+// Only millisecond resolution available, everything under 1ms lands in the first bucket
+uint32_t split_link_stats_timestamp(void) {
+    return timer_read32();
+}
+
+static uint32_t split_link_stats_elapsed_us(uint32_t start) {
+    return timer_elapsed32(start) * 1000;
+}
+#    endif
+
+////////////////////////////////////////////////////
+// Recording
+
+void split_link_stats_record_transaction(int8_t id, bool okay, uint16_t bytes, uint32_t start) {
+    uint32_t elapsed = split_link_stats_elapsed_us(start);
+    uint8_t  bucket  = 0;
+    while (bucket < (SPLIT_LINK_STATS_HISTOGRAM_BUCKETS - 1) && elapsed >= ((uint32_t)SPLIT_LINK_STATS_HISTOGRAM_BASE_US << bucket)) {
+        ++bucket;
+    }
+    split_link_stats.latency_histogram[bucket]++;
+
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS) {
+        return;
+    }
+
+    split_link_transaction_stats_t *stats = &split_link_stats.transactions[id];
+    stats->attempts++;
+    if (okay) {
+        stats->bytes += bytes;
+    } else {
+        stats->failures++;
+    }
+}
+
+void split_link_stats_record_retry(void) {
+    split_link_stats.retries++;
+}
+
+void split_link_stats_record_handler_failure(void) {
+    split_link_stats.handler_failures++;
+}
+
+void split_link_stats_record_checksum_failure(int8_t id) {
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS) {
+        return;
+    }
+    split_link_stats.transactions[id].checksum_failures++;
+}
+
+////////////////////////////////////////////////////
+// Reporting
+
+const split_link_stats_t *split_link_stats_get(void) {
+    return &split_link_stats;
+}
+
+void split_link_stats_reset(void) {
+    memset(&split_link_stats, 0, sizeof(split_link_stats));
+}
+
+void split_link_stats_print(void) {
+    uprintf("split link: retries=%" PRIu32 " handler_failures=%" PRIu32 "\n", split_link_stats.retries, split_link_stats.handler_failures);
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+        split_link_transaction_stats_t *stats = &split_link_stats.transactions[id];
+        if (stats->attempts == 0) {
+            continue;
+        }
+        uprintf("  [%2d] attempts=%" PRIu32 " failures=%" PRIu32 " crc=%" PRIu32 " bytes=%" PRIu32 "\n", (int)id, stats->attempts, stats->failures, stats->checksum_failures, stats->bytes);
+    }
+    uprintf("  latency:");
+    for (uint8_t i = 0; i < SPLIT_LINK_STATS_HISTOGRAM_BUCKETS; ++i) {
+        if (i < SPLIT_LINK_STATS_HISTOGRAM_BUCKETS - 1) {
+            uprintf(" <%" PRIu32 "us=%" PRIu32, (uint32_t)SPLIT_LINK_STATS_HISTOGRAM_BASE_US << i, split_link_stats.latency_histogram[i]);
+        } else {
+            uprintf(" >=%" PRIu32 "us=%" PRIu32, (uint32_t)SPLIT_LINK_STATS_HISTOGRAM_BASE_US << (i - 1), split_link_stats.latency_histogram[i]);
+        }
+    }
+    uprintf("\n");
+}
+
+static uint8_t *split_link_stats_put_u32(uint8_t *data, uint32_t value) {
+    data[0] = (value >> 24) & 0xFF;
+    data[1] = (value >> 16) & 0xFF;
+    data[2] = (value >> 8) & 0xFF;
+    data[3] = value & 0xFF;
+    return data + 4;
+}
+
+bool split_link_stats_get_report(uint8_t selector, uint8_t *data, uint8_t length) {
+    if (selector == SPLIT_LINK_STATS_REPORT_SUMMARY) {
+        if (length < 12) return false;
+        data = split_link_stats_put_u32(data, split_link_stats.retries);
+        data = split_link_stats_put_u32(data, split_link_stats.handler_failures);
+        data = split_link_stats_put_u32(data, NUM_TOTAL_TRANSACTIONS);
+        return true;
+    }
+
+    if (selector == SPLIT_LINK_STATS_REPORT_HISTOGRAM) {
+        if (length < SPLIT_LINK_STATS_HISTOGRAM_BUCKETS * 4) return false;
+        for (uint8_t i = 0; i < SPLIT_LINK_STATS_HISTOGRAM_BUCKETS; ++i) {
+            data = split_link_stats_put_u32(data, split_link_stats.latency_histogram[i]);
+        }
+        return true;
+    }
+
+    if (selector >= NUM_TOTAL_TRANSACTIONS || length < 16) {
+        return false;
+    }
+
+    split_link_transaction_stats_t *stats = &split_link_stats.transactions[selector];
+    data                                  = split_link_stats_put_u32(data, stats->attempts);
+    data                                  = split_link_stats_put_u32(data, stats->failures);
+    data                                  = split_link_stats_put_u32(data, stats->checksum_failures);
+    data                                  = split_link_stats_put_u32(data, stats->bytes);
+    return true;
+}
+
+////////////////////////////////////////////////////
+// Benchmark
+
+#    ifdef SPLIT_COMMON_TRANSACTIONS
+static bool split_link_benchmark_fetch(matrix_row_t slave_matrix[]) {
+    return transport_execute_transaction(GET_SLAVE_MATRIX_DATA, NULL, 0, slave_matrix, sizeof(split_shmem->smatrix.matrix));
+}
+#    else
+// Custom transports only expose the full master/slave exchange
+static bool split_link_benchmark_fetch(matrix_row_t slave_matrix[]) {
+    matrix_row_t master_matrix[MATRIX_ROWS_PER_HAND] = {0};
+    return transport_master(master_matrix, slave_matrix);
+}
+#    endif
+
+split_link_benchmark_result_t split_link_benchmark(uint16_t duration_ms) {
+    split_link_benchmark_result_t result = {0};
+    if (!is_keyboard_master()) {
+        return result;
+    }
+
+    matrix_row_t buffer[MATRIX_ROWS_PER_HAND];
+    uint32_t     start = timer_read32();
+    while (timer_elapsed32(start) < duration_ms) {
+        result.transactions++;
+        if (split_link_benchmark_fetch(buffer)) {
+            result.bytes += sizeof(buffer);
+        } else {
+            result.failures++;
+        }
+    }
+
+    result.elapsed_ms = timer_elapsed32(start);
+    if (result.elapsed_ms > 0) {
+        result.bytes_per_sec = (uint32_t)(((uint64_t)result.bytes * 1000) / result.elapsed_ms);
+    }
+
+    uprintf("split link benchmark: %" PRIu32 " transactions (%" PRIu32 " failed), %" PRIu32 " bytes in %" PRIu32 "ms, %" PRIu32 " bytes/sec\n", result.transactions, result.failures, result.bytes, result.elapsed_ms, result.bytes_per_sec);
+    return result;
+}
+
+#endif // SPLIT_LINK_STATS_ENABLE
@@ -0,0 +1,86 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "transaction_id_define.h"
+
+// Latency histogram buckets, in microseconds: <128, <256, <512, <1024, <2048, <4096, >=4096
+#define SPLIT_LINK_STATS_HISTOGRAM_BUCKETS 7
+#define SPLIT_LINK_STATS_HISTOGRAM_BASE_US 128
+
+// Report selectors for split_link_stats_get_report(), anything below these is treated as a transaction ID
+#define SPLIT_LINK_STATS_REPORT_HISTOGRAM 0xFE
+#define SPLIT_LINK_STATS_REPORT_SUMMARY 0xFF
+
+typedef struct split_link_transaction_stats_t {
+    uint32_t attempts;
+    uint32_t failures;
+    uint32_t checksum_failures;
+    uint32_t bytes;
+} split_link_transaction_stats_t;
+
+typedef struct split_link_stats_t {
+    split_link_transaction_stats_t transactions[NUM_TOTAL_TRANSACTIONS];
+    uint32_t                       retries;
+    uint32_t                       handler_failures;
+    uint32_t                       latency_histogram[SPLIT_LINK_STATS_HISTOGRAM_BUCKETS];
+} split_link_stats_t;
+
+typedef struct split_link_benchmark_result_t {
+    uint32_t elapsed_ms;
+    uint32_t transactions;
+    uint32_t failures;
+    uint32_t bytes;
+    uint32_t bytes_per_sec;
+} split_link_benchmark_result_t;
+
+#ifdef SPLIT_LINK_STATS_ENABLE
+
+uint32_t split_link_stats_timestamp(void);
+void     split_link_stats_record_transaction(int8_t id, bool okay, uint16_t bytes, uint32_t start);
+void     split_link_stats_record_retry(void);
+void     split_link_stats_record_handler_failure(void);
+void     split_link_stats_record_checksum_failure(int8_t id);
+
+const split_link_stats_t *split_link_stats_get(void);
+void                      split_link_stats_reset(void);
+void                      split_link_stats_print(void);
+
+/**
+ * @brief Fill a buffer with the statistics page selected by `selector`.
+ *
+ * `selector` is either a transaction ID, `SPLIT_LINK_STATS_REPORT_HISTOGRAM` or
+ * `SPLIT_LINK_STATS_REPORT_SUMMARY`. All values are written big-endian, so the
+ * buffer can be returned as-is from `via_custom_value_command_kb()`.
+ *
+ * @return false if the selector is invalid or the buffer is too small
+ */
+bool split_link_stats_get_report(uint8_t selector, uint8_t *data, uint8_t length);
+
+/**
+ * @brief Saturate the split link from the master side for `duration_ms`.
+ *
+ * Repeatedly fetches the slave matrix, which every transport supports, and
+ * reports the effective throughput over console. This blocks the caller for
+ * the whole duration, so it should only be triggered manually when tuning
+ * baud rate or `FORCED_SYNC_THROTTLE_MS`.
+ */
+split_link_benchmark_result_t split_link_benchmark(uint16_t duration_ms);
+
+#else // SPLIT_LINK_STATS_ENABLE
+
+#    define split_link_stats_record_retry() \
+        do {                                \
+        } while (0)
+#    define split_link_stats_record_handler_failure() \
+        do {                                          \
+        } while (0)
+#    define split_link_stats_record_checksum_failure(id) \
+        do {                                             \
+        } while (0)
+
+#endif // SPLIT_LINK_STATS_ENABLE
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 8
+#define MATRIX_COLS 8
+
+#define SPLIT_TRANSPORT_MIRROR
+#define SPLIT_TRANSACTION_IDS_USER USER_SYNC_A
+#define SPLIT_LINK_STATS_ENABLE
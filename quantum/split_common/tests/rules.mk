@@ -0,0 +1,45 @@
+split_transactions_DEFS := \
+	-DSPLIT_KEYBOARD \
+	-DSPLIT_COMMON_TRANSACTIONS \
+	-DNO_PRINT \
+	-DNO_DEBUG
+split_transactions_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_split_sim.h
+split_transactions_INC := \
+	$(QUANTUM_PATH)/split_common \
+	$(PLATFORM_PATH)/test/drivers
+split_transactions_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/synchronization_util.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/split_link_sim.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/split_link_stats.c \
+	$(QUANTUM_PATH)/split_common/tests/split_transactions_tests.cpp
+
+split_oled_mirror_DEFS := \
+	-DSPLIT_KEYBOARD \
+	-DSPLIT_COMMON_TRANSACTIONS \
+	-DOLED_ENABLE \
+	-DSPLIT_OLED_ENABLE \
+	-DSPLIT_OLED_MIRROR_ENABLE \
+	-DNO_PRINT \
+	-DNO_DEBUG
+split_oled_mirror_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_split_sim.h
+split_oled_mirror_INC := \
+	$(QUANTUM_PATH)/split_common \
+	$(PLATFORM_PATH)/test/drivers \
+	$(DRIVER_PATH)/oled
+split_oled_mirror_SRC := \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/synchronization_util.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/split_link_sim.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/split_link_stats.c \
+	$(QUANTUM_PATH)/split_common/tests/split_oled_mirror_tests.cpp
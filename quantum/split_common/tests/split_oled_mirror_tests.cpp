@@ -0,0 +1,201 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+extern "C" {
+#include "transactions.h"
+#include "transport.h"
+#include "split_link_stats.h"
+#include "split_link_sim.h"
+#include "sync_timer.h"
+#include "timer.h"
+#include "oled_driver.h"
+
+void set_time(uint32_t t);
+
+bool is_keyboard_master(void) {
+    return !split_link_sim_is_slave_active();
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+}
+
+// Minimal stand-in for the OLED driver on each half, just the buffer and the block tracking used for mirroring. Both
+// halves run in this one process, so the real driver is covered on its own in platforms/test/oled_driver_tests.cpp.
+struct FakeOled {
+    uint8_t         buffer[OLED_MATRIX_SIZE];
+    OLED_BLOCK_TYPE mirror_dirty;
+    bool            on;
+    uint32_t        blocks_applied;
+};
+
+static FakeOled halves[2];
+
+static FakeOled &this_half(void) {
+    return halves[is_keyboard_master() ? 0 : 1];
+}
+
+extern "C" {
+bool is_oled_on(void) {
+    return this_half().on;
+}
+
+bool oled_on(void) {
+    return this_half().on = true;
+}
+
+bool oled_off(void) {
+    return this_half().on = false;
+}
+
+bool oled_mirror_get_block(uint8_t *block, uint8_t *data) {
+    FakeOled &oled = this_half();
+    for (uint8_t i = 0; i < OLED_BLOCK_COUNT; ++i) {
+        if (oled.mirror_dirty & ((OLED_BLOCK_TYPE)1 << i)) {
+            oled.mirror_dirty &= ~((OLED_BLOCK_TYPE)1 << i);
+            memcpy(data, &oled.buffer[OLED_BLOCK_SIZE * i], OLED_BLOCK_SIZE);
+            *block = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void oled_mirror_all(void) {
+    this_half().mirror_dirty = (OLED_BLOCK_TYPE)~0;
+}
+
+void oled_mirror_set_block(uint8_t block, const uint8_t *data) {
+    memcpy(&this_half().buffer[OLED_BLOCK_SIZE * block], data, OLED_BLOCK_SIZE);
+    this_half().blocks_applied++;
+}
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitOledMirror : public ::testing::Test {
+   protected:
+    matrix_row_t master_view_master[HALF_ROWS];
+    matrix_row_t master_view_slave[HALF_ROWS];
+    matrix_row_t slave_view_master[HALF_ROWS];
+    matrix_row_t slave_view_slave[HALF_ROWS];
+
+    void SetUp() override {
+        set_time(0);
+        sync_timer_init();
+        split_link_stats_reset();
+        memset(halves, 0, sizeof(halves));
+        memset(master_view_master, 0, sizeof(master_view_master));
+        memset(master_view_slave, 0, sizeof(master_view_slave));
+        memset(slave_view_master, 0, sizeof(slave_view_master));
+        memset(slave_view_slave, 0, sizeof(slave_view_slave));
+    }
+
+    void init_link(uint32_t bit_error_ppm) {
+        split_link_sim_config_t config = {
+            .latency_us    = 100,
+            .bytes_per_sec = 0,
+            .bit_error_ppm = bit_error_ppm,
+            .seed          = 0x1234,
+        };
+        split_link_sim_init(&config);
+
+        split_link_sim_set_connected(false);
+        transactions_master(master_view_master, master_view_slave);
+        split_link_sim_set_connected(true);
+        split_link_stats_reset();
+    }
+
+    bool cycle(void) {
+        split_link_sim_slave_task(slave_view_master, slave_view_slave);
+        return transactions_master(master_view_master, master_view_slave);
+    }
+
+    // Draws on the master, tracking changed blocks the way the driver does
+    void draw(uint16_t index, uint8_t value) {
+        halves[0].buffer[index] = value;
+        halves[0].mirror_dirty |= (OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE);
+    }
+
+    bool in_sync(void) {
+        return memcmp(halves[0].buffer, halves[1].buffer, OLED_MATRIX_SIZE) == 0;
+    }
+};
+
+TEST_F(SplitOledMirror, ChangedBlocksReachSlave) {
+    init_link(0);
+    // Everything is sent once at startup
+    for (size_t i = 0; i < OLED_BLOCK_COUNT * 2 + 2; ++i) {
+        EXPECT_TRUE(cycle());
+    }
+    halves[1].blocks_applied = 0;
+
+    draw(3, 0xAA);
+    draw(OLED_MATRIX_SIZE - 1, 0x55);
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_TRUE(cycle());
+    }
+    EXPECT_TRUE(in_sync());
+    EXPECT_EQ(halves[1].blocks_applied, 2u) << "Only the changed blocks are sent";
+}
+
+TEST_F(SplitOledMirror, UnchangedBufferIsNotResent) {
+    init_link(0);
+    for (size_t i = 0; i < OLED_BLOCK_COUNT * 2 + 2; ++i) {
+        EXPECT_TRUE(cycle());
+    }
+
+    uint32_t start = timer_read32();
+    uint32_t base  = split_link_stats_get()->transactions[PUT_OLED_MIRROR].attempts;
+    while (timer_elapsed32(start) < 50) {
+        EXPECT_TRUE(cycle());
+    }
+    EXPECT_EQ(split_link_stats_get()->transactions[PUT_OLED_MIRROR].attempts, base);
+}
+
+TEST_F(SplitOledMirror, OnOffStateFollowsMaster) {
+    init_link(0);
+    halves[0].on = true;
+    EXPECT_TRUE(cycle());
+    split_link_sim_slave_task(slave_view_master, slave_view_slave);
+    EXPECT_TRUE(halves[1].on);
+}
+
+TEST_F(SplitOledMirror, SlaveRebootIsRedrawn) {
+    init_link(0);
+    draw(40, 0x12);
+    for (size_t i = 0; i < OLED_BLOCK_COUNT * 2 + 2; ++i) {
+        EXPECT_TRUE(cycle());
+    }
+    EXPECT_TRUE(in_sync());
+
+    // The restarted slave has a blank buffer, and has acknowledged nothing yet
+    memset(halves[1].buffer, 0, sizeof(halves[1].buffer));
+    init_link(0);
+    for (size_t i = 0; i < OLED_BLOCK_COUNT * 2 + 2; ++i) {
+        EXPECT_TRUE(cycle());
+    }
+    EXPECT_TRUE(in_sync());
+}
+
+TEST_F(SplitOledMirror, NoisyLinkConverges) {
+    init_link(500);
+    for (int frame = 0; frame < 50; ++frame) {
+        draw((frame * 37) % OLED_MATRIX_SIZE, frame);
+        draw((frame * 101) % OLED_MATRIX_SIZE, ~frame);
+        cycle();
+        cycle();
+    }
+
+    // Corrupted blocks are never applied, and are sent again until they get through
+    for (size_t i = 0; i < OLED_BLOCK_COUNT * 8; ++i) {
+        cycle();
+    }
+    EXPECT_TRUE(in_sync());
+    EXPECT_GT(split_link_sim_get_stats()->bit_errors, 0u);
+}
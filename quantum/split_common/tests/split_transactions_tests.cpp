@@ -0,0 +1,194 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+extern "C" {
+#include "transactions.h"
+#include "transport.h"
+#include "split_link_stats.h"
+#include "split_link_sim.h"
+#include "sync_timer.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+
+bool is_keyboard_master(void) {
+    return !split_link_sim_is_slave_active();
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitTransactions : public ::testing::Test {
+   protected:
+    // Each half keeps its own copy of both matrices, just like two separate MCUs
+    matrix_row_t master_view_master[HALF_ROWS];
+    matrix_row_t master_view_slave[HALF_ROWS];
+    matrix_row_t slave_view_master[HALF_ROWS];
+    matrix_row_t slave_view_slave[HALF_ROWS];
+
+    void SetUp() override {
+        set_time(0);
+        sync_timer_init();
+        split_link_stats_reset();
+        memset(master_view_master, 0, sizeof(master_view_master));
+        memset(master_view_slave, 0, sizeof(master_view_slave));
+        memset(slave_view_master, 0, sizeof(slave_view_master));
+        memset(slave_view_slave, 0, sizeof(slave_view_slave));
+    }
+
+    void init_link(uint32_t latency_us, uint32_t bytes_per_sec, uint32_t bit_error_ppm) {
+        split_link_sim_config_t config = {
+            .latency_us    = latency_us,
+            .bytes_per_sec = bytes_per_sec,
+            .bit_error_ppm = bit_error_ppm,
+            .seed          = 0x1234,
+        };
+        split_link_sim_init(&config);
+
+        // Reinitialising the link is a slave reboot, which the master notices as a dropped transaction
+        split_link_sim_set_connected(false);
+        transactions_master(master_view_master, master_view_slave);
+        split_link_sim_set_connected(true);
+        split_link_stats_reset();
+    }
+
+    // One scan cycle on each half; the slave publishes first, as it would between master polls
+    bool cycle(void) {
+        split_link_sim_slave_task(slave_view_master, slave_view_slave);
+        return transactions_master(master_view_master, master_view_slave);
+    }
+};
+
+TEST_F(SplitTransactions, SlaveMatrixReachesMaster) {
+    init_link(100, 0, 0);
+    slave_view_slave[0] = 0x81;
+    slave_view_slave[3] = 0x42;
+
+    EXPECT_TRUE(cycle());
+    EXPECT_EQ(memcmp(master_view_slave, slave_view_slave, sizeof(slave_view_slave)), 0);
+}
+
+TEST_F(SplitTransactions, MasterMatrixIsMirroredToSlave) {
+    init_link(100, 0, 0);
+    master_view_master[1] = 0x18;
+
+    EXPECT_TRUE(cycle());
+    // The mirrored matrix is applied on the slave's next scan
+    split_link_sim_slave_task(slave_view_master, slave_view_slave);
+    EXPECT_EQ(memcmp(slave_view_master, master_view_master, sizeof(master_view_master)), 0);
+}
+
+TEST_F(SplitTransactions, CorruptedMatrixIsNeverAccepted) {
+    init_link(50, 0, 2000);
+
+    for (int i = 0; i < 500; ++i) {
+        for (int row = 0; row < HALF_ROWS; ++row) {
+            slave_view_slave[row] = (matrix_row_t)(i * 7 + row * 13);
+        }
+        matrix_row_t last_good[HALF_ROWS];
+        memcpy(last_good, master_view_slave, sizeof(last_good));
+
+        if (cycle()) {
+            EXPECT_EQ(memcmp(master_view_slave, slave_view_slave, sizeof(slave_view_slave)), 0) << "iteration " << i;
+        } else {
+            // On failure the master must fall back to a state that was actually sent
+            bool was_last_good = memcmp(master_view_slave, last_good, sizeof(last_good)) == 0;
+            bool is_current    = memcmp(master_view_slave, slave_view_slave, sizeof(slave_view_slave)) == 0;
+            EXPECT_TRUE(was_last_good || is_current) << "iteration " << i;
+        }
+    }
+
+    EXPECT_GT(split_link_sim_get_stats()->bit_errors, 0u);
+    EXPECT_GT(split_link_stats_get()->retries, 0u);
+}
+
+TEST_F(SplitTransactions, UnchangedMatrixIsNotRetransferred) {
+    init_link(100, 0, 0);
+    slave_view_slave[2] = 0x24;
+    EXPECT_TRUE(cycle());
+
+    // Well inside the default 100ms forced resync interval, so at most one rolling resync may hit the matrix
+    uint32_t start = timer_read32();
+    uint32_t base  = split_link_stats_get()->transactions[GET_SLAVE_MATRIX_DATA].attempts;
+    while (timer_elapsed32(start) < 50) {
+        EXPECT_TRUE(cycle());
+    }
+    EXPECT_LE(split_link_stats_get()->transactions[GET_SLAVE_MATRIX_DATA].attempts - base, 1u);
+    EXPECT_GT(split_link_stats_get()->transactions[GET_SLAVE_MATRIX_HEADER].attempts, base + 10);
+
+    // A change is picked up on the very next cycle
+    slave_view_slave[2] = 0x42;
+    EXPECT_TRUE(cycle());
+    EXPECT_EQ(memcmp(master_view_slave, slave_view_slave, sizeof(slave_view_slave)), 0);
+}
+
+TEST_F(SplitTransactions, SlaveRebootIsResynced) {
+    init_link(100, 0, 0);
+    slave_view_slave[0] = 0x11;
+    EXPECT_TRUE(cycle());
+
+    // Restarted slave publishes different data under a generation the master has already seen
+    init_link(100, 0, 0);
+    slave_view_slave[0] = 0x22;
+    EXPECT_TRUE(cycle());
+    EXPECT_EQ(memcmp(master_view_slave, slave_view_slave, sizeof(slave_view_slave)), 0);
+}
+
+static void rpc_echo_increment(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    const uint8_t *in  = (const uint8_t *)in_data;
+    uint8_t       *out = (uint8_t *)out_data;
+    for (uint8_t i = 0; i < in_buflen && i < out_buflen; ++i) {
+        out[i] = in[i] + 1;
+    }
+}
+
+TEST_F(SplitTransactions, RpcRoundTrip) {
+    init_link(200, 0, 0);
+    transaction_register_rpc(USER_SYNC_A, rpc_echo_increment);
+
+    uint8_t request[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8_t response[8];
+    memset(response, 0, sizeof(response));
+
+    EXPECT_TRUE(transaction_rpc_exec(USER_SYNC_A, sizeof(request), request, sizeof(response), response));
+    for (uint8_t i = 0; i < sizeof(request); ++i) {
+        EXPECT_EQ(response[i], request[i] + 1);
+    }
+}
+
+static void read_slave_sync_timer(void *arg) {
+    *(uint32_t *)arg = sync_timer_read32();
+}
+
+TEST_F(SplitTransactions, SyncTimerDriftIsBounded) {
+    // Slow, high latency link: a transaction costs a bit over a millisecond
+    init_link(1000, 20000, 0);
+
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_TRUE(cycle());
+
+        uint32_t slave_time;
+        split_link_sim_run_on_slave(read_slave_sync_timer, &slave_time);
+        int32_t drift = (int32_t)(slave_time - timer_read32());
+        EXPECT_LE(drift < 0 ? -drift : drift, 3) << "iteration " << i;
+    }
+}
+
+TEST_F(SplitTransactions, BenchmarkIsBoundedByBandwidth) {
+    init_link(0, 10000, 0);
+
+    split_link_benchmark_result_t result = split_link_benchmark(1000);
+    EXPECT_EQ(result.failures, 0u);
+    EXPECT_GT(result.bytes_per_sec, 0u);
+    // Each transaction also carries two handshake bytes, so payload throughput is below raw bandwidth
+    EXPECT_LT(result.bytes_per_sec, 10000u);
+    EXPECT_EQ(split_link_stats_get()->transactions[GET_SLAVE_MATRIX_DATA].attempts, result.transactions);
+}
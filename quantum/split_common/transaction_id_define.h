@@ -23,7 +23,7 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
-    GET_SLAVE_MATRIX_CHECKSUM,
+    GET_SLAVE_MATRIX_HEADER,
     GET_SLAVE_MATRIX_DATA,
 
 #ifdef SPLIT_TRANSPORT_MIRROR
@@ -31,7 +31,7 @@ enum serial_transaction_id {
 #endif // SPLIT_TRANSPORT_MIRROR
 
 #ifdef ENCODER_ENABLE
-    GET_ENCODERS_CHECKSUM,
+    GET_ENCODERS_HEADER,
     GET_ENCODERS_DATA,
     CMD_ENCODER_DRAIN,
 #endif // ENCODER_ENABLE
@@ -75,6 +75,10 @@ enum serial_transaction_id {
 
 #if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
     PUT_OLED,
+#    ifdef SPLIT_OLED_MIRROR_ENABLE
+    PUT_OLED_MIRROR,
+    GET_OLED_MIRROR_ACK,
+#    endif // SPLIT_OLED_MIRROR_ENABLE
 #endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
@@ -82,7 +86,7 @@ enum serial_transaction_id {
 #endif // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
-    GET_POINTING_CHECKSUM,
+    GET_POINTING_HEADER,
     GET_POINTING_DATA,
     PUT_POINTING_CPI,
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
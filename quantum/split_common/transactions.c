@@ -29,6 +29,7 @@
 #include "transport.h"
 #include "transaction_id_define.h"
 #include "split_util.h"
+#include "split_link_stats.h"
 #include "synchronization_util.h"
 
 #ifdef BACKLIGHT_ENABLE
@@ -67,6 +68,7 @@
 
 #define SYNC_TIMER_OFFSET 2
 
+// Interval between forced resyncs. Each forced resync only covers a single transaction, rotating through all of them.
 #ifndef FORCED_SYNC_THROTTLE_MS
 #    define FORCED_SYNC_THROTTLE_MS 100
 #endif // FORCED_SYNC_THROTTLE_MS
@@ -98,6 +100,7 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
     int num_retries = is_transport_connected() ? 10 : 1;
     for (int iter = 1; iter <= num_retries; ++iter) {
         if (iter > 1) {
+            split_link_stats_record_retry();
             for (int i = 0; i < iter * iter; ++i) {
                 wait_us(10);
             }
@@ -106,7 +109,8 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         this_okay      = handler(master_matrix, slave_matrix);
         if (this_okay) return true;
     }
-    dprintf("Failed to execute %s\n", prefix);
+    split_link_stats_record_handler_failure();
+    dprintf("Failed to execute %s after %d attempts\n", prefix, num_retries);
     return false;
 }
 
@@ -141,14 +145,41 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
-inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
-    uint8_t curr_checksum;
-    bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
-    if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
+#define FORCED_SYNC_NONE -1
+#define FORCED_SYNC_ALL -2
+
+// Transaction selected for a forced resync during the current master cycle, if any
+static int8_t forced_sync_id = FORCED_SYNC_NONE;
+
+static void forced_sync_advance(bool resync_all) {
+    static uint32_t last_forced_sync = 0;
+    static int8_t   next_forced_id   = 0;
+
+    forced_sync_id = FORCED_SYNC_NONE;
+    if (resync_all) {
+        // The slave may have restarted and reused generations we have already seen, so resend/reread everything
+        forced_sync_id = FORCED_SYNC_ALL;
+    } else if (timer_elapsed32(last_forced_sync) >= FORCED_SYNC_THROTTLE_MS) {
+        forced_sync_id   = next_forced_id;
+        next_forced_id   = (next_forced_id + 1) % NUM_TOTAL_TRANSACTIONS;
+        last_forced_sync = timer_read32();
+    }
+}
+
+#define forced_sync_due(trans_id) (forced_sync_id == FORCED_SYNC_ALL || forced_sync_id == (trans_id))
+
+inline static bool read_if_generation_changed(int8_t trans_id_header, int8_t trans_id_retrieve, uint8_t *last_generation, void *destination, const void *equiv_shmem, size_t length) {
+    split_sync_header_t header;
+    bool                okay = transport_read(trans_id_header, &header, sizeof(header));
+    if (okay && (forced_sync_due(trans_id_retrieve) || header.generation != *last_generation)) {
         okay &= transport_read(trans_id_retrieve, destination, length);
-        okay &= curr_checksum == crc8(equiv_shmem, length);
+        // Only verify the checksum when data has actually been transferred
+        if (okay && header.checksum != crc8(equiv_shmem, length)) {
+            split_link_stats_record_checksum_failure(trans_id_retrieve);
+            okay = false;
+        }
         if (okay) {
-            *last_update = timer_read32();
+            *last_generation = header.generation;
         }
     } else {
         memcpy(destination, equiv_shmem, length);
@@ -156,31 +187,40 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
     return okay;
 }
 
-inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
+inline static void publish_if_changed(split_sync_header_t *header, void *equiv_shmem, const void *source, size_t length) {
+    // Only bump the generation, and pay for the checksum, when the published data changes.
+    // Generation 0 is reserved for "never published", so that the initial state is always sent.
+    if (header->generation == 0 || memcmp(equiv_shmem, source, length) != 0) {
+        memcpy(equiv_shmem, source, length);
+        header->checksum = crc8(equiv_shmem, length);
+        if (++header->generation == 0) {
+            header->generation = 1;
+        }
+    }
+}
+
+inline static bool send_if_condition(int8_t trans_id, bool condition, void *source, size_t length) {
     bool okay = true;
-    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
+    if (forced_sync_due(trans_id) || condition) {
         okay &= transport_write(trans_id, source, length);
-        if (okay) {
-            *last_update = timer_read32();
-        }
     }
     return okay;
 }
 
-inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update, void *source, const void *equiv_shmem, size_t length) {
+inline static bool send_if_data_mismatch(int8_t trans_id, void *source, const void *equiv_shmem, size_t length) {
     // Just run a memcmp to compare the source and equivalent shmem location
-    return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
+    return send_if_condition(trans_id, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
 ////////////////////////////////////////////////////
 // Slave matrix
 
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t     last_update                    = 0;
+    static uint8_t      last_generation                = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
     matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
 
-    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    bool okay = read_if_generation_changed(GET_SLAVE_MATRIX_HEADER, GET_SLAVE_MATRIX_DATA, &last_generation, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
     if (okay) {
         // Checksum matches the received data, save as the last matrix state
         memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
@@ -191,16 +231,15 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
-    split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    publish_if_changed(&split_shmem->smatrix.header, split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
 }
 
 // clang-format off
 #define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
-    [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
-    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+    [GET_SLAVE_MATRIX_HEADER] = trans_target2initiator_initializer(smatrix.header), \
+    [GET_SLAVE_MATRIX_DATA]   = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
 ////////////////////////////////////////////////////
@@ -209,8 +248,7 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 #ifdef SPLIT_TRANSPORT_MIRROR
 
 static bool master_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    return send_if_data_mismatch(PUT_MASTER_MATRIX, &last_update, master_matrix, split_shmem->mmatrix.matrix, sizeof(split_shmem->mmatrix.matrix));
+    return send_if_data_mismatch(PUT_MASTER_MATRIX, master_matrix, split_shmem->mmatrix.matrix, sizeof(split_shmem->mmatrix.matrix));
 }
 
 static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -236,13 +274,13 @@ static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_ro
 #ifdef ENCODER_ENABLE
 
 static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t  last_update   = 0;
-    static uint8_t   last_checksum = 0;
+    static uint8_t   last_generation = 0;
+    uint8_t          prev_generation = last_generation;
     encoder_events_t temp_events;
 
-    bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, &temp_events, &split_shmem->encoders.events, sizeof(temp_events));
+    bool okay = read_if_generation_changed(GET_ENCODERS_HEADER, GET_ENCODERS_DATA, &last_generation, &temp_events, &split_shmem->encoders.events, sizeof(temp_events));
     if (okay) {
-        if (last_checksum != split_shmem->encoders.checksum) {
+        if (prev_generation != last_generation) {
             bool    actioned = false;
             uint8_t index;
             bool    clockwise;
@@ -254,17 +292,16 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
             if (actioned) {
                 okay &= transport_exec(CMD_ENCODER_DRAIN);
             }
-            last_checksum = split_shmem->encoders.checksum;
         }
     }
     return okay;
 }
 
 static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    // Always prepare the encoder state for read.
-    encoder_retrieve_events(&split_shmem->encoders.events);
-    // Now update the checksum given that the encoders has been written to
-    split_shmem->encoders.checksum = crc8(&split_shmem->encoders.events, sizeof(split_shmem->encoders.events));
+    // Always prepare the encoder state for read, only publishing a new generation if it changed.
+    encoder_events_t events;
+    encoder_retrieve_events(&events);
+    publish_if_changed(&split_shmem->encoders.header, &split_shmem->encoders.events, &events, sizeof(events));
 }
 
 static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
@@ -275,9 +312,9 @@ static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, c
 #    define TRANSACTIONS_ENCODERS_MASTER() TRANSACTION_HANDLER_MASTER(encoder)
 #    define TRANSACTIONS_ENCODERS_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(encoder)
 #    define TRANSACTIONS_ENCODERS_REGISTRATIONS \
-    [GET_ENCODERS_CHECKSUM] = trans_target2initiator_initializer(encoders.checksum), \
-    [GET_ENCODERS_DATA]     = trans_target2initiator_initializer(encoders.events), \
-    [CMD_ENCODER_DRAIN]     = trans_initiator2target_cb(encoder_handlers_slave_drain),
+    [GET_ENCODERS_HEADER] = trans_target2initiator_initializer(encoders.header), \
+    [GET_ENCODERS_DATA]   = trans_target2initiator_initializer(encoders.events), \
+    [CMD_ENCODER_DRAIN]   = trans_initiator2target_cb(encoder_handlers_slave_drain),
 // clang-format on
 
 #else // ENCODER_ENABLE
@@ -333,12 +370,9 @@ static void sync_timer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if !defined(NO_ACTION_LAYER) && defined(SPLIT_LAYER_STATE_ENABLE)
 
 static bool layer_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_layer_state_update         = 0;
-    static uint32_t last_default_layer_state_update = 0;
-
-    bool okay = send_if_condition(PUT_LAYER_STATE, &last_layer_state_update, (layer_state != split_shmem->layers.layer_state), &layer_state, sizeof(layer_state));
+    bool okay = send_if_condition(PUT_LAYER_STATE, (layer_state != split_shmem->layers.layer_state), &layer_state, sizeof(layer_state));
     if (okay) {
-        okay &= send_if_condition(PUT_DEFAULT_LAYER_STATE, &last_default_layer_state_update, (default_layer_state != split_shmem->layers.default_layer_state), &default_layer_state, sizeof(default_layer_state));
+        okay &= send_if_condition(PUT_DEFAULT_LAYER_STATE, (default_layer_state != split_shmem->layers.default_layer_state), &default_layer_state, sizeof(default_layer_state));
     }
     return okay;
 }
@@ -370,9 +404,8 @@ static void layer_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 #ifdef SPLIT_LED_STATE_ENABLE
 
 static bool led_state_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    uint8_t         led_state   = host_keyboard_leds();
-    return send_if_data_mismatch(PUT_LED_STATE, &last_update, &led_state, &split_shmem->led_state, sizeof(led_state));
+    uint8_t led_state = host_keyboard_leds();
+    return send_if_data_mismatch(PUT_LED_STATE, &led_state, &split_shmem->led_state, sizeof(led_state));
 }
 
 static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -398,8 +431,7 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #ifdef SPLIT_MODS_ENABLE
 
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t   last_update    = 0;
-    bool              mods_need_sync = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
+    bool              mods_need_sync = forced_sync_due(PUT_MODS);
     split_mods_sync_t new_mods;
     new_mods.real_mods = get_mods();
     if (!mods_need_sync && new_mods.real_mods != split_shmem->mods.real_mods) {
@@ -425,9 +457,6 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
     bool okay = true;
     if (mods_need_sync) {
         okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
-        if (okay) {
-            last_update = timer_read32();
-        }
     }
 
     return okay;
@@ -465,9 +494,8 @@ static void mods_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #ifdef BACKLIGHT_ENABLE
 
 static bool backlight_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    uint8_t         level       = is_backlight_enabled() ? get_backlight_level() : 0;
-    return send_if_condition(PUT_BACKLIGHT, &last_update, (level != split_shmem->backlight_level), &level, sizeof(level));
+    uint8_t level = is_backlight_enabled() ? get_backlight_level() : 0;
+    return send_if_condition(PUT_BACKLIGHT, (level != split_shmem->backlight_level), &level, sizeof(level));
 }
 
 static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -496,10 +524,9 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
 static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t     last_update = 0;
     rgblight_syncinfo_t rgblight_sync;
     rgblight_get_syncinfo(&rgblight_sync);
-    if (send_if_condition(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync))) {
+    if (send_if_condition(PUT_RGBLIGHT, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync))) {
         rgblight_clear_change_flags();
     } else {
         return false;
@@ -538,11 +565,10 @@ static void rgblight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #if defined(LED_MATRIX_ENABLE) && defined(LED_MATRIX_SPLIT)
 
 static bool led_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t   last_update = 0;
     led_matrix_sync_t led_matrix_sync;
     memcpy(&led_matrix_sync.led_matrix, &led_matrix_eeconfig, sizeof(led_eeconfig_t));
     led_matrix_sync.led_suspend_state = led_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_LED_MATRIX, &last_update, &led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync));
+    return send_if_data_mismatch(PUT_LED_MATRIX, &led_matrix_sync, &split_shmem->led_matrix_sync, sizeof(led_matrix_sync));
 }
 
 static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -572,11 +598,10 @@ static void led_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
 
 static bool rgb_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t   last_update = 0;
     rgb_matrix_sync_t rgb_matrix_sync;
     memcpy(&rgb_matrix_sync.rgb_matrix, &rgb_matrix_config, sizeof(rgb_config_t));
     rgb_matrix_sync.rgb_suspend_state = rgb_matrix_get_suspend_state();
-    return send_if_data_mismatch(PUT_RGB_MATRIX, &last_update, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
+    return send_if_data_mismatch(PUT_RGB_MATRIX, &rgb_matrix_sync, &split_shmem->rgb_matrix_sync, sizeof(rgb_matrix_sync));
 }
 
 static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -606,9 +631,8 @@ static void rgb_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if defined(WPM_ENABLE) && defined(SPLIT_WPM_ENABLE)
 
 static bool wpm_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update = 0;
-    uint8_t         current_wpm = get_current_wpm();
-    return send_if_condition(PUT_WPM, &last_update, (current_wpm != split_shmem->current_wpm), &current_wpm, sizeof(current_wpm));
+    uint8_t current_wpm = get_current_wpm();
+    return send_if_condition(PUT_WPM, (current_wpm != split_shmem->current_wpm), &current_wpm, sizeof(current_wpm));
 }
 
 static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -632,10 +656,89 @@ static void wpm_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_
 
 #if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
+#    ifdef SPLIT_OLED_MIRROR_ENABLE
+// Sends at most one changed block of the OLED buffer per cycle, once the slave has applied the previous one
+static bool oled_mirror_handlers_master(void) {
+    static split_oled_mirror_sync_t pending;
+    static bool                     has_pending  = false;
+    static bool                     pending_sent = false;
+    split_oled_mirror_ack_t         ack;
+
+    if (forced_sync_due(PUT_OLED_MIRROR)) {
+        if (!transport_read(GET_OLED_MIRROR_ACK, &ack, sizeof(ack))) {
+            return false;
+        }
+        // Sequence 0 is never sent, so the slave has restarted and needs the whole buffer again
+        if (ack.sequence == 0) {
+            oled_mirror_all();
+            has_pending = false;
+        }
+        // Carry on from the slave's last acknowledged sequence, in case it's this half that restarted
+        if (!has_pending) {
+            pending.payload.sequence = ack.sequence;
+        }
+        pending_sent = false;
+    }
+
+    if (has_pending && pending_sent) {
+        if (!transport_read(GET_OLED_MIRROR_ACK, &ack, sizeof(ack))) {
+            return false;
+        }
+        if (ack.sequence == pending.payload.sequence && ack.checksum == pending.checksum) {
+            has_pending = false;
+        } else {
+            // Not applied, most likely corrupted on the way
+            pending_sent = false;
+        }
+    }
+
+    if (!has_pending) {
+        if (!oled_mirror_get_block(&pending.payload.block, pending.payload.data)) {
+            return true;
+        }
+        if (++pending.payload.sequence == 0) {
+            pending.payload.sequence = 1;
+        }
+        pending.checksum = crc8(&pending.payload, sizeof(pending.payload));
+        has_pending      = true;
+        pending_sent     = false;
+    }
+
+    if (!pending_sent) {
+        pending_sent = transport_write(PUT_OLED_MIRROR, &pending, sizeof(pending));
+    }
+    return pending_sent;
+}
+
+static void oled_mirror_handlers_slave(void) {
+    static split_oled_mirror_sync_t mirror;
+
+    split_shared_memory_lock();
+    bool received = split_shmem->oled_mirror.payload.sequence != split_shmem->oled_mirror_ack.sequence && split_shmem->oled_mirror.checksum == crc8(&split_shmem->oled_mirror.payload, sizeof(mirror.payload));
+    if (received) {
+        memcpy(&mirror, &split_shmem->oled_mirror, sizeof(mirror));
+        split_shmem->oled_mirror_ack.sequence = mirror.payload.sequence;
+        split_shmem->oled_mirror_ack.checksum = mirror.checksum;
+    }
+    split_shared_memory_unlock();
+
+    if (received) {
+        oled_mirror_set_block(mirror.payload.block, mirror.payload.data);
+    }
+}
+
+#        define TRANSACTIONS_OLED_MIRROR_REGISTRATIONS [PUT_OLED_MIRROR] = trans_initiator2target_initializer(oled_mirror), [GET_OLED_MIRROR_ACK] = trans_target2initiator_initializer(oled_mirror_ack),
+#    else // SPLIT_OLED_MIRROR_ENABLE
+#        define TRANSACTIONS_OLED_MIRROR_REGISTRATIONS
+#    endif // SPLIT_OLED_MIRROR_ENABLE
+
 static bool oled_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update        = 0;
-    bool            current_oled_state = is_oled_on();
-    return send_if_condition(PUT_OLED, &last_update, (current_oled_state != split_shmem->current_oled_state), &current_oled_state, sizeof(current_oled_state));
+    bool current_oled_state = is_oled_on();
+    bool okay               = send_if_condition(PUT_OLED, (current_oled_state != split_shmem->current_oled_state), &current_oled_state, sizeof(current_oled_state));
+#    ifdef SPLIT_OLED_MIRROR_ENABLE
+    okay = okay && oled_mirror_handlers_master();
+#    endif // SPLIT_OLED_MIRROR_ENABLE
+    return okay;
 }
 
 static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -648,11 +751,15 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
     } else {
         oled_off();
     }
+
+#    ifdef SPLIT_OLED_MIRROR_ENABLE
+    oled_mirror_handlers_slave();
+#    endif // SPLIT_OLED_MIRROR_ENABLE
 }
 
 #    define TRANSACTIONS_OLED_MASTER() TRANSACTION_HANDLER_MASTER(oled)
 #    define TRANSACTIONS_OLED_SLAVE() TRANSACTION_HANDLER_SLAVE(oled)
-#    define TRANSACTIONS_OLED_REGISTRATIONS [PUT_OLED] = trans_initiator2target_initializer(current_oled_state),
+#    define TRANSACTIONS_OLED_REGISTRATIONS [PUT_OLED] = trans_initiator2target_initializer(current_oled_state), TRANSACTIONS_OLED_MIRROR_REGISTRATIONS
 
 #else // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
@@ -668,9 +775,8 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
 static bool st7565_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_update          = 0;
-    bool            current_st7565_state = st7565_is_on();
-    return send_if_condition(PUT_ST7565, &last_update, (current_st7565_state != split_shmem->current_st7565_state), &current_st7565_state, sizeof(current_st7565_state));
+    bool current_st7565_state = st7565_is_on();
+    return send_if_condition(PUT_ST7565, (current_st7565_state != split_shmem->current_st7565_state), &current_st7565_state, sizeof(current_st7565_state));
 }
 
 static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -712,17 +818,16 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
         return true;
     }
 #    endif
-    static uint32_t last_update     = 0;
-    static uint32_t last_cpi_update = 0;
+    static uint8_t  last_generation = 0;
     static uint16_t last_cpi        = 0;
     report_mouse_t  temp_state;
     uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
+    bool            okay = read_if_generation_changed(GET_POINTING_HEADER, GET_POINTING_DATA, &last_generation, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
     if (okay) pointing_device_set_shared_report(temp_state);
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi) {
         split_shmem->pointing.cpi = temp_cpi;
-        okay                      = send_if_condition(PUT_POINTING_CPI, &last_cpi_update, last_cpi != temp_cpi, &split_shmem->pointing.cpi, sizeof(split_shmem->pointing.cpi));
+        okay                      = send_if_condition(PUT_POINTING_CPI, last_cpi != temp_cpi, &split_shmem->pointing.cpi, sizeof(split_shmem->pointing.cpi));
         if (okay) {
             last_cpi = temp_cpi;
         }
@@ -753,26 +858,23 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     uint16_t temp_cpi = !pointing_device_driver->get_cpi ? 0 : pointing_device_driver->get_cpi(); // check for NULL
 
     split_shared_memory_lock();
-    split_slave_pointing_sync_t pointing;
-    memcpy(&pointing, &split_shmem->pointing, sizeof(split_slave_pointing_sync_t));
+    uint16_t cpi = split_shmem->pointing.cpi;
     split_shared_memory_unlock();
 
-    if (pointing.cpi && pointing.cpi != temp_cpi && pointing_device_driver->set_cpi) {
-        pointing_device_driver->set_cpi(pointing.cpi);
+    if (cpi && cpi != temp_cpi && pointing_device_driver->set_cpi) {
+        pointing_device_driver->set_cpi(cpi);
     }
 
-    pointing.report = pointing_device_driver->get_report((report_mouse_t){0});
-    // Now update the checksum given that the pointing has been written to
-    pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
+    report_mouse_t report = pointing_device_driver->get_report((report_mouse_t){0});
 
     split_shared_memory_lock();
-    memcpy(&split_shmem->pointing, &pointing, sizeof(split_slave_pointing_sync_t));
+    publish_if_changed(&split_shmem->pointing.header, &split_shmem->pointing.report, &report, sizeof(report_mouse_t));
     split_shared_memory_unlock();
 }
 
 #    define TRANSACTIONS_POINTING_MASTER() TRANSACTION_HANDLER_MASTER(pointing)
 #    define TRANSACTIONS_POINTING_SLAVE() TRANSACTION_HANDLER_SLAVE(pointing)
-#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_HEADER] = trans_target2initiator_initializer(pointing.header), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
 
 #else // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -818,13 +920,12 @@ uint8_t                split_haptic_play = 0xFF;
 extern haptic_config_t haptic_config;
 
 static bool haptic_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t           last_update = 0;
     split_slave_haptic_sync_t haptic_sync;
 
     memcpy(&haptic_sync.haptic_config, &haptic_config, sizeof(haptic_config_t));
     haptic_sync.haptic_play = split_haptic_play;
 
-    bool okay = send_if_data_mismatch(PUT_HAPTIC, &last_update, &haptic_sync, &split_shmem->haptic_sync, sizeof(haptic_sync));
+    bool okay = send_if_data_mismatch(PUT_HAPTIC, &haptic_sync, &split_shmem->haptic_sync, sizeof(haptic_sync));
 
     split_haptic_play = 0xFF;
 
@@ -857,12 +958,11 @@ static void haptic_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 #if defined(SPLIT_ACTIVITY_ENABLE)
 
 static bool activity_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t             last_update = 0;
     split_slave_activity_sync_t activity_sync;
     activity_sync.matrix_timestamp          = last_matrix_activity_time();
     activity_sync.encoder_timestamp         = last_encoder_activity_time();
     activity_sync.pointing_device_timestamp = last_pointing_device_activity_time();
-    return send_if_data_mismatch(PUT_ACTIVITY, &last_update, &activity_sync, &split_shmem->activity_sync, sizeof(activity_sync));
+    return send_if_data_mismatch(PUT_ACTIVITY, &activity_sync, &split_shmem->activity_sync, sizeof(activity_sync));
 }
 
 static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -889,9 +989,8 @@ static void activity_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
 static bool detected_os_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t last_detected_os_update = 0;
-    os_variant_t    detected_os             = detected_host_os();
-    bool            okay                    = send_if_condition(PUT_DETECTED_OS, &last_detected_os_update, (detected_os != split_shmem->detected_os), &detected_os, sizeof(os_variant_t));
+    os_variant_t detected_os = detected_host_os();
+    bool         okay        = send_if_condition(PUT_DETECTED_OS, (detected_os != split_shmem->detected_os), &detected_os, sizeof(os_variant_t));
     return okay;
 }
 
@@ -952,6 +1051,11 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // Any failed transaction returns early, leaving a full resync pending for the next cycle
+    static bool resync_all = true;
+    forced_sync_advance(resync_all);
+    resync_all = true;
+
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -971,6 +1075,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    resync_all = false;
     return true;
 }
 
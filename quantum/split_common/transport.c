@@ -22,6 +22,7 @@
 #include "transport.h"
 #include "transaction_id_define.h"
 #include "atomic_util.h"
+#include "split_link_stats.h"
 
 #ifdef USE_I2C
 
@@ -60,7 +61,7 @@ i2c_status_t transport_trigger_callback(int8_t id) {
     return i2c_write_register(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, SLAVE_I2C_TIMEOUT);
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_execute_transaction_impl(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     i2c_status_t              status;
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
@@ -87,6 +88,16 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     return true;
 }
 
+#    ifdef SPLIT_LINK_STATS_ENABLE
+static uint16_t transport_transaction_bytes(split_transaction_desc_t *trans, uint16_t initiator2target_length, uint16_t target2initiator_length) {
+    // Only the requested portion of each buffer crosses the bus, plus the transaction ID if a callback is triggered
+    uint16_t bytes = trans->slave_callback ? 1 : 0;
+    bytes += trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+    bytes += trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+    return bytes;
+}
+#    endif // SPLIT_LINK_STATS_ENABLE
+
 #else // USE_I2C
 
 #    include "serial.h"
@@ -101,7 +112,7 @@ void transport_slave_init(void) {
     soft_serial_target_init();
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+static bool transport_execute_transaction_impl(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
@@ -120,8 +131,26 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     return true;
 }
 
+#    ifdef SPLIT_LINK_STATS_ENABLE
+static uint16_t transport_transaction_bytes(split_transaction_desc_t *trans, uint16_t initiator2target_length, uint16_t target2initiator_length) {
+    // The serial protocol always transfers the full buffers, plus the handshake byte in each direction
+    return 2 + trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+}
+#    endif // SPLIT_LINK_STATS_ENABLE
+
 #endif // USE_I2C
 
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+#ifdef SPLIT_LINK_STATS_ENABLE
+    uint32_t start = split_link_stats_timestamp();
+    bool     okay  = transport_execute_transaction_impl(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    split_link_stats_record_transaction(id, okay, transport_transaction_bytes(&split_transaction_table[id], initiator2target_length, target2initiator_length), start);
+    return okay;
+#else
+    return transport_execute_transaction_impl(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+#endif // SPLIT_LINK_STATS_ENABLE
+}
+
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     return transactions_master(master_matrix, slave_matrix);
 }
@@ -52,9 +52,16 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #    include "rgblight.h"
 #endif // RGBLIGHT_ENABLE
 
+// Prefixes data published by the slave. The generation changes whenever the data does, so the master
+// only needs to fetch the header to know whether its copy is stale. The checksum covers the data.
+typedef struct _split_sync_header_t {
+    uint8_t generation;
+    uint8_t checksum;
+} split_sync_header_t;
+
 typedef struct _split_slave_matrix_sync_t {
-    uint8_t      checksum;
-    matrix_row_t matrix[(MATRIX_ROWS) / 2];
+    split_sync_header_t header;
+    matrix_row_t        matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
 #ifdef SPLIT_TRANSPORT_MIRROR
@@ -65,8 +72,8 @@ typedef struct _split_master_matrix_sync_t {
 
 #ifdef ENCODER_ENABLE
 typedef struct _split_slave_encoder_sync_t {
-    uint8_t          checksum;
-    encoder_events_t events;
+    split_sync_header_t header;
+    encoder_events_t    events;
 } split_slave_encoder_sync_t;
 #endif // ENCODER_ENABLE
 
@@ -106,12 +113,31 @@ typedef struct _split_mods_sync_t {
 } split_mods_sync_t;
 #endif // SPLIT_MODS_ENABLE
 
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE) && defined(SPLIT_OLED_MIRROR_ENABLE)
+#    include "oled_driver.h"
+// One block of the master's OLED buffer. The sequence changes with every block sent, and the slave acknowledges each
+// one it applies, so that the master doesn't overwrite a block the slave hasn't seen yet.
+typedef struct _split_oled_mirror_sync_t {
+    uint8_t checksum;
+    struct {
+        uint8_t sequence;
+        uint8_t block;
+        uint8_t data[OLED_BLOCK_SIZE];
+    } payload;
+} split_oled_mirror_sync_t;
+
+typedef struct _split_oled_mirror_ack_t {
+    uint8_t sequence;
+    uint8_t checksum;
+} split_oled_mirror_ack_t;
+#endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE) && defined(SPLIT_OLED_MIRROR_ENABLE)
+
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 #    include "pointing_device.h"
 typedef struct _split_slave_pointing_sync_t {
-    uint8_t        checksum;
-    report_mouse_t report;
-    uint16_t       cpi;
+    split_sync_header_t header;
+    report_mouse_t      report;
+    uint16_t            cpi;
 } split_slave_pointing_sync_t;
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -200,6 +226,10 @@ typedef struct _split_shared_memory_t {
 
 #if defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
     uint8_t current_oled_state;
+#    ifdef SPLIT_OLED_MIRROR_ENABLE
+    split_oled_mirror_sync_t oled_mirror;
+    split_oled_mirror_ack_t  oled_mirror_ack;
+#    endif // SPLIT_OLED_MIRROR_ENABLE
 #endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
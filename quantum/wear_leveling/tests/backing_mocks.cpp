@@ -20,15 +20,17 @@ void MockBackingStore::reset_instance() {
 
     backing_init_invoke_count   = 0;
     backing_unlock_invoke_count = 0;
-    backing_erase_invoke_count  = 0;
-    backing_write_invoke_count  = 0;
-    backing_lock_invoke_count   = 0;
-
-    init_success_callback   = [](std::uint64_t) { return true; };
-    erase_success_callback  = [](std::uint64_t) { return true; };
-    unlock_success_callback = [](std::uint64_t) { return true; };
-    write_success_callback  = [](std::uint64_t, std::uint32_t) { return true; };
-    lock_success_callback   = [](std::uint64_t) { return true; };
+    backing_erase_invoke_count         = 0;
+    backing_erase_partial_invoke_count = 0;
+    backing_write_invoke_count         = 0;
+    backing_lock_invoke_count          = 0;
+
+    init_success_callback          = [](std::uint64_t) { return true; };
+    erase_success_callback         = [](std::uint64_t) { return true; };
+    erase_partial_success_callback = [](std::uint64_t, std::uint32_t) { return true; };
+    unlock_success_callback        = [](std::uint64_t) { return true; };
+    write_success_callback         = [](std::uint64_t, std::uint32_t) { return true; };
+    lock_success_callback          = [](std::uint64_t) { return true; };
 
     write_log.clear();
 }
@@ -75,6 +77,33 @@ bool MockBackingStore::erase(void) {
     return true;
 }
 
+bool MockBackingStore::erase_partial(uint32_t address, uint32_t max_length, uint32_t& erased_length) {
+    ++backing_erase_partial_invoke_count;
+    erased_length = 0;
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    EXPECT_TRUE(address % MOCK_ERASE_UNIT_SIZE == 0) << "Supplied address was not aligned with the erase unit size";
+    EXPECT_TRUE(address + MOCK_ERASE_UNIT_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
+    EXPECT_FALSE(is_locked()) << "Erase was attempted without being unlocked first";
+    if (max_length < MOCK_ERASE_UNIT_SIZE) {
+        return false;
+    }
+
+    // Drop out of erase early with failure if we need to
+    if (erase_partial_success_callback && !erase_partial_success_callback(backing_erase_partial_invoke_count, address)) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < MOCK_ERASE_UNIT_SIZE / BACKING_STORE_WRITE_SIZE; ++i) {
+        backing_storage[(address / BACKING_STORE_WRITE_SIZE) + i].erase();
+    }
+    erased_length = MOCK_ERASE_UNIT_SIZE;
+    return true;
+#else  // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    return false;
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+}
+
 bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     ++backing_write_invoke_count;
 
@@ -141,6 +170,12 @@ extern "C" bool backing_store_erase(void) {
     return MockBackingStore::Instance().erase();
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+extern "C" bool backing_store_erase_partial(uint32_t address, uint32_t max_length, uint32_t* erased_length) {
+    return MockBackingStore::Instance().erase_partial(address, max_length, *erased_length);
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 extern "C" bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return MockBackingStore::Instance().write(address, value);
 }
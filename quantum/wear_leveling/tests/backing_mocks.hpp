@@ -17,6 +17,12 @@ extern "C" {
 
 // Maximum number of mock write log entries to keep
 using MOCK_WRITE_LOG_MAX_ENTRIES = std::integral_constant<std::size_t, 1024>;
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+// Size of the smallest erasable unit, for partial erases
+#    ifndef MOCK_ERASE_UNIT_SIZE
+#        define MOCK_ERASE_UNIT_SIZE 16
+#    endif
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
 // Complement to the backing store integral, for emulating flash erases of all bytes=0xFF
 using BACKING_STORE_INTEGRAL_COMPLEMENT = std::integral_constant<backing_store_int_t, ((backing_store_int_t)(~(backing_store_int_t)0))>;
 // Total number of elements stored in the backing arrays
@@ -94,6 +100,7 @@ class MockBackingStore {
     std::uint64_t backing_init_invoke_count;
     std::uint64_t backing_unlock_invoke_count;
     std::uint64_t backing_erase_invoke_count;
+    std::uint64_t backing_erase_partial_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
 
@@ -101,6 +108,8 @@ class MockBackingStore {
     std::function<bool(std::uint64_t)> init_success_callback;
     // Whether erase should succeed
     std::function<bool(std::uint64_t)> erase_success_callback;
+    // Whether partial erases should succeed
+    std::function<bool(std::uint64_t, std::uint32_t)> erase_partial_success_callback;
     // Whether unlocks should succeed
     std::function<bool(std::uint64_t)> unlock_success_callback;
     // Whether writes should succeed
@@ -141,6 +150,9 @@ class MockBackingStore {
     std::uint64_t erase_invoke_count() const {
         return backing_erase_invoke_count;
     }
+    std::uint64_t erase_partial_invoke_count() const {
+        return backing_erase_partial_invoke_count;
+    }
     std::uint64_t write_invoke_count() const {
         return backing_write_invoke_count;
     }
@@ -159,6 +171,7 @@ class MockBackingStore {
     bool init();
     bool unlock();
     bool erase();
+    bool erase_partial(std::uint32_t address, std::uint32_t max_length, std::uint32_t& erased_length);
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
@@ -170,6 +183,9 @@ class MockBackingStore {
     void set_erase_callback(std::function<bool(std::uint64_t)> callback) {
         erase_success_callback = callback;
     }
+    void set_erase_partial_callback(std::function<bool(std::uint64_t, std::uint32_t)> callback) {
+        erase_partial_success_callback = callback;
+    }
     void set_unlock_callback(std::function<bool(std::uint64_t)> callback) {
         unlock_success_callback = callback;
     }
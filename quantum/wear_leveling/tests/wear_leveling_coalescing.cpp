@@ -0,0 +1,163 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingCoalescing : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        baseline = *wear_leveling_get_stats();
+    }
+
+    wear_leveling_stats_t baseline;
+
+    uint32_t deferred() const {
+        return wear_leveling_get_stats()->deferred_writes - baseline.deferred_writes;
+    }
+    uint32_t coalesced() const {
+        return wear_leveling_get_stats()->coalesced_writes - baseline.coalesced_writes;
+    }
+    uint32_t flushed() const {
+        return wear_leveling_get_stats()->flushed_writes - baseline.flushed_writes;
+    }
+};
+
+/**
+ * This test verifies that repeated writes to the same address do not touch the backing store until flushed, and only the final value is logged.
+ */
+TEST_F(WearLevelingCoalescing, RepeatedWrites_SingleLogEntry) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (uint8_t i = 1; i <= 10; ++i) {
+        EXPECT_EQ(wear_leveling_write(0x04, &i, sizeof(i)), WEAR_LEVELING_SUCCESS) << "Deferred write should have succeeded";
+    }
+
+    EXPECT_EQ(inst.unlock_invoke_count(), 0) << "Unlock should not have been invoked before flush";
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should not have been invoked before flush";
+    EXPECT_TRUE(wear_leveling_has_pending_writes()) << "Writes should be pending";
+
+    uint8_t readback = 0;
+    EXPECT_EQ(wear_leveling_read(0x04, &readback, sizeof(readback)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(readback, 10) << "Readback should come from cache before flush";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush should have succeeded";
+    EXPECT_FALSE(wear_leveling_has_pending_writes()) << "Nothing should be pending after flush";
+    EXPECT_EQ(inst.unlock_invoke_count(), 1) << "Unlock should have been invoked once";
+    EXPECT_EQ(inst.write_invoke_count(), 1) << "Only a single optimized log entry should have been written";
+    EXPECT_EQ(inst.lock_invoke_count(), 1) << "Lock should have been invoked once";
+
+    EXPECT_EQ(deferred(), 10) << "All writes should have been deferred";
+    EXPECT_EQ(coalesced(), 9) << "All but the first write should have been coalesced";
+    EXPECT_EQ(flushed(), 1) << "A single range should have been flushed";
+
+    // Re-init and make sure the final value was persisted
+    readback = 0;
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(wear_leveling_read(0x04, &readback, sizeof(readback)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(readback, 10) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that adjacent writes are merged into a single range.
+ */
+TEST_F(WearLevelingCoalescing, AdjacentWrites_Merged) {
+    uint8_t a = 0x11, b = 0x22, c = 0x33;
+    EXPECT_EQ(wear_leveling_write(0x02, &a, sizeof(a)), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(wear_leveling_write(0x04, &c, sizeof(c)), WEAR_LEVELING_SUCCESS);
+    // Bridges the two pending ranges
+    EXPECT_EQ(wear_leveling_write(0x03, &b, sizeof(b)), WEAR_LEVELING_SUCCESS);
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush should have succeeded";
+    EXPECT_EQ(flushed(), 1) << "Bridged ranges should have been flushed as one";
+
+    uint8_t readback[3] = {0};
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(wear_leveling_read(0x02, readback, sizeof(readback)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_THAT(readback, ::testing::ElementsAre(0x11, 0x22, 0x33)) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that running out of slots for disjoint ranges flushes the pending ranges first.
+ */
+TEST_F(WearLevelingCoalescing, SlotsExhausted_FlushesPending) {
+    auto& inst = MockBackingStore::Instance();
+
+    for (uint32_t i = 0; i < WEAR_LEVELING_COALESCE_SLOTS; ++i) {
+        uint8_t v = 0x40 + i;
+        EXPECT_EQ(wear_leveling_write(i * 2, &v, sizeof(v)), WEAR_LEVELING_SUCCESS);
+    }
+    EXPECT_EQ(inst.write_invoke_count(), 0) << "Write should not have been invoked while slots are available";
+
+    uint8_t v = 0x7F;
+    EXPECT_EQ(wear_leveling_write(0x0F, &v, sizeof(v)), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(flushed(), WEAR_LEVELING_COALESCE_SLOTS) << "All previously pending ranges should have been flushed";
+    EXPECT_TRUE(wear_leveling_has_pending_writes()) << "The newest write should still be pending";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush should have succeeded";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    for (uint32_t i = 0; i < WEAR_LEVELING_COALESCE_SLOTS; ++i) {
+        uint8_t readback = 0;
+        wear_leveling_read(i * 2, &readback, sizeof(readback));
+        EXPECT_EQ(readback, 0x40 + i) << "Invalid readback after re-init";
+    }
+    uint8_t readback = 0;
+    wear_leveling_read(0x0F, &readback, sizeof(readback));
+    EXPECT_EQ(readback, 0x7F) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that a consolidation during flush accounts for every pending range.
+ */
+TEST_F(WearLevelingCoalescing, ConsolidationDuringFlush_ClearsPending) {
+    auto& inst = MockBackingStore::Instance();
+
+    // Fill the write log until the next append consolidates
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+    EXPECT_EQ(wear_leveling_write(0, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_CONSOLIDATED) << "Full logical write should have consolidated";
+    EXPECT_EQ(inst.erasure_count(), 1) << "Backing store should have been erased once";
+    EXPECT_FALSE(wear_leveling_has_pending_writes()) << "Nothing should be pending after consolidation";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(readback, testvalue) << "Invalid readback after re-init";
+}
+
+/**
+ * This test verifies that a failed flush leaves the data pending for a later retry.
+ */
+TEST_F(WearLevelingCoalescing, FlushFailure_RemainsPending) {
+    auto& inst = MockBackingStore::Instance();
+    inst.set_write_callback([](std::uint64_t count, std::uint32_t address) { return false; });
+
+    uint8_t v = 0x55;
+    EXPECT_EQ(wear_leveling_write(0x06, &v, sizeof(v)), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_FAILED) << "Flush should have failed";
+    EXPECT_TRUE(wear_leveling_has_pending_writes()) << "Failed range should still be pending";
+
+    inst.set_write_callback([](std::uint64_t count, std::uint32_t address) { return true; });
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Retried flush should have succeeded";
+    EXPECT_FALSE(wear_leveling_has_pending_writes()) << "Nothing should be pending after flush";
+}
+
+/**
+ * This test verifies that erasing discards pending writes.
+ */
+TEST_F(WearLevelingCoalescing, Erase_DiscardsPending) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t v = 0x55;
+    EXPECT_EQ(wear_leveling_write(0x06, &v, sizeof(v)), WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase should have succeeded";
+    EXPECT_FALSE(wear_leveling_has_pending_writes()) << "Nothing should be pending after erase";
+
+    uint64_t write_count = inst.write_invoke_count();
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush should have succeeded";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Write should not have been invoked";
+}
@@ -0,0 +1,220 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+// Second bank's sequence number, written last when committing a migration
+#define BANK1_SEQUENCE_ADDRESS (WEAR_LEVELING_BANK_SIZE + WEAR_LEVELING_LOGICAL_SIZE + 8)
+
+class WearLevelingIncremental : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::iota(expected.begin(), expected.end(), 0x10);
+        EXPECT_EQ(wear_leveling_write(0, expected.data(), expected.size()), WEAR_LEVELING_SUCCESS) << "Initial write should have succeeded";
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> expected;
+
+    // Single byte writes until the active bank's write log reaches the migration threshold
+    void fill_log_to_threshold(void) {
+        for (int i = 0; !wear_leveling_consolidation_pending(); ++i) {
+            ASSERT_LT(i, 64) << "Migration threshold was never reached";
+            write_byte(i % WEAR_LEVELING_LOGICAL_SIZE, expected[i % WEAR_LEVELING_LOGICAL_SIZE] + 0x40);
+        }
+    }
+
+    void write_byte(uint32_t address, uint8_t value) {
+        expected[address] = value;
+        EXPECT_EQ(wear_leveling_write(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write should not have consolidated";
+    }
+
+    // Steps until the banks have been swapped, returning the number of steps taken
+    int step_until_consolidated(void) {
+        for (int steps = 1; steps < 64; ++steps) {
+            wear_leveling_status_t status = wear_leveling_consolidate_step();
+            EXPECT_NE(status, WEAR_LEVELING_FAILED) << "Step should have succeeded";
+            if (status == WEAR_LEVELING_CONSOLIDATED) {
+                return steps;
+            }
+        }
+        ADD_FAILURE() << "Migration never completed";
+        return 0;
+    }
+
+    void step_until_idle(void) {
+        for (int steps = 0; wear_leveling_consolidation_pending(); ++steps) {
+            ASSERT_LT(steps, 64) << "Background consolidation never went idle";
+            EXPECT_NE(wear_leveling_consolidate_step(), WEAR_LEVELING_FAILED) << "Step should have succeeded";
+        }
+    }
+
+    // Simulates a power cycle, then verifies the data
+    void verify_after_reinit(void) {
+        EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+        EXPECT_EQ(readback, expected) << "Invalid readback after re-init";
+    }
+};
+
+/**
+ * This test verifies that background consolidation never erases the whole backing store, and does a bounded amount of work per step.
+ */
+TEST_F(WearLevelingIncremental, BackgroundMigration_BoundedSteps) {
+    auto& inst = MockBackingStore::Instance();
+    EXPECT_FALSE(wear_leveling_consolidation_pending()) << "Nothing should be pending on a fresh store";
+    fill_log_to_threshold();
+
+    for (int steps = 0; wear_leveling_consolidation_pending(); ++steps) {
+        ASSERT_LT(steps, 64) << "Background consolidation never went idle";
+        std::uint64_t writes = inst.write_invoke_count();
+        std::uint64_t erases = inst.erase_partial_invoke_count();
+        EXPECT_NE(wear_leveling_consolidate_step(), WEAR_LEVELING_FAILED) << "Step should have succeeded";
+        // One chunk, plus the checksum and sequence number on commit
+        EXPECT_LE(inst.write_invoke_count() - writes, (WEAR_LEVELING_INCREMENTAL_STEP_SIZE + 16) / BACKING_STORE_WRITE_SIZE) << "Step wrote too much";
+        EXPECT_LE(inst.erase_partial_invoke_count() - erases, 1) << "Step erased too much";
+    }
+
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Full erase should never have been invoked";
+    EXPECT_EQ(inst.erase_partial_invoke_count(), WEAR_LEVELING_BANK_SIZE / MOCK_ERASE_UNIT_SIZE) << "Stale bank should have been erased exactly once";
+    EXPECT_TRUE(inst.is_locked()) << "Backing store should have been locked after stepping";
+    verify_after_reinit();
+
+    // The next migration goes back into the first bank
+    fill_log_to_threshold();
+    EXPECT_GT(step_until_consolidated(), 1) << "Copy should have been split across steps";
+    step_until_idle();
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Full erase should never have been invoked";
+    verify_after_reinit();
+}
+
+/**
+ * This test verifies that losing power part way through copying leaves the original bank in use.
+ */
+TEST_F(WearLevelingIncremental, InterruptedCopy_KeepsData) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log_to_threshold();
+    EXPECT_EQ(wear_leveling_consolidate_step(), WEAR_LEVELING_SUCCESS) << "First chunk should have been copied";
+
+    verify_after_reinit();
+    EXPECT_TRUE(wear_leveling_consolidation_pending()) << "Partially copied bank should be pending erase";
+
+    step_until_consolidated();
+    step_until_idle();
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Full erase should never have been invoked";
+    verify_after_reinit();
+}
+
+/**
+ * This test verifies that losing power before the sequence number is written leaves the original bank in use.
+ */
+TEST_F(WearLevelingIncremental, InterruptedCommit_KeepsData) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log_to_threshold();
+
+    inst.set_write_callback([](std::uint64_t count, std::uint32_t address) { return address != BANK1_SEQUENCE_ADDRESS; });
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_consolidate_step();
+    } while (status == WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(status, WEAR_LEVELING_FAILED) << "Commit should have failed";
+
+    inst.set_write_callback([](std::uint64_t count, std::uint32_t address) { return true; });
+    verify_after_reinit();
+
+    // The uncommitted bank is discarded and the migration redone
+    step_until_consolidated();
+    step_until_idle();
+    verify_after_reinit();
+}
+
+/**
+ * This test verifies that losing power while erasing the stale bank keeps the newly committed bank, including anything written to it since.
+ */
+TEST_F(WearLevelingIncremental, InterruptedStaleErase_KeepsNewBank) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log_to_threshold();
+    step_until_consolidated();
+
+    write_byte(0x05, 0xA5);
+    EXPECT_EQ(wear_leveling_consolidate_step(), WEAR_LEVELING_SUCCESS) << "First erase unit should have been erased";
+    EXPECT_EQ(inst.erase_partial_invoke_count(), 1) << "Only a single erase unit should have been erased";
+
+    verify_after_reinit();
+    step_until_idle();
+    verify_after_reinit();
+}
+
+/**
+ * This test verifies that writes to already-copied data during a migration are carried over into the new bank.
+ */
+TEST_F(WearLevelingIncremental, WritesDuringMigration_Survive) {
+    fill_log_to_threshold();
+    EXPECT_EQ(wear_leveling_consolidate_step(), WEAR_LEVELING_SUCCESS) << "First chunk should have been copied";
+
+    write_byte(0x01, 0xC1);                                    // already copied
+    write_byte(WEAR_LEVELING_LOGICAL_SIZE - 1, 0xC2);          // not yet copied
+    write_byte(WEAR_LEVELING_INCREMENTAL_STEP_SIZE - 1, 0xC3); // last byte of the copied chunk
+
+    step_until_consolidated();
+    verify_after_reinit();
+    step_until_idle();
+    verify_after_reinit();
+}
+
+/**
+ * This test verifies that filling the write log before the background migration runs completes it in-line, without a full erase.
+ */
+TEST_F(WearLevelingIncremental, LogFull_CompletesSynchronously) {
+    auto& inst = MockBackingStore::Instance();
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (int i = 0; status == WEAR_LEVELING_SUCCESS; ++i) {
+        ASSERT_LT(i, 256) << "Write log never filled";
+        uint32_t address  = i % WEAR_LEVELING_LOGICAL_SIZE;
+        expected[address] = (uint8_t)(expected[address] + 1);
+        status            = wear_leveling_write(address, &expected[address], 1);
+    }
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Full write log should have consolidated";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Full erase should never have been invoked";
+    verify_after_reinit();
+
+    // Stale bank is still erased in the background
+    EXPECT_TRUE(wear_leveling_consolidation_pending()) << "Stale bank should be pending erase";
+    step_until_idle();
+    verify_after_reinit();
+}
+
+/**
+ * This test verifies that a backing store which can't erase a single bank falls back to erasing everything, rather than failing every migration.
+ */
+TEST_F(WearLevelingIncremental, PartialEraseFails_FallsBackToFullErase) {
+    auto& inst = MockBackingStore::Instance();
+    inst.set_erase_partial_callback([](std::uint64_t count, std::uint32_t address) { return false; });
+
+    // Background consolidation swaps banks, then can't erase the stale one
+    fill_log_to_threshold();
+    step_until_consolidated();
+    step_until_idle();
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Full erase should have been invoked once";
+    EXPECT_TRUE(inst.is_locked()) << "Backing store should have been locked after stepping";
+    verify_after_reinit();
+
+    // Filling the write log still consolidates, and keeps doing so
+    for (int consolidations = 0; consolidations < 3;) {
+        uint32_t address              = consolidations % WEAR_LEVELING_LOGICAL_SIZE;
+        expected[address]             = (uint8_t)(expected[address] + 1);
+        wear_leveling_status_t status = wear_leveling_write(address, &expected[address], 1);
+        ASSERT_NE(status, WEAR_LEVELING_FAILED) << "Write should have succeeded";
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            ++consolidations;
+            verify_after_reinit();
+        }
+    }
+    // Migrating into the bank left erased by the fallback needs no erase, only the one after it does
+    EXPECT_EQ(inst.erase_invoke_count(), 2) << "Stale bank should have been erased in full once more";
+}
@@ -77,6 +77,31 @@
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
+        With WEAR_LEVELING_COALESCE_WRITES, writes only update the cache and
+        record the modified address range. Overlapping or adjacent ranges are
+        merged, and the write log is only appended to when the pending ranges
+        are explicitly flushed, or when no free slot remains for a new range.
+
+    Incremental consolidation:
+
+        With WEAR_LEVELING_INCREMENTAL_CONSOLIDATION, the backing store is
+        split into two banks, each with its own consolidated data, checksum and
+        write log. The consolidated data's checksum is followed by a sequence
+        number, which is written last and marks the bank as committed. On
+        startup, the committed bank with the highest sequence number and valid
+        checksum is used.
+
+        Once the active bank's write log is half full, the cache is copied into
+        the inactive bank a step at a time by wear_leveling_consolidate_step().
+        Writes to areas already copied are also appended to the inactive bank's
+        write log. When the copy completes, the checksum and sequence number are
+        written and the banks swap roles, after which the stale bank is erased
+        one erase unit per step. If the active bank's log fills up before this
+        completes, the remaining steps are performed in-line.
+
+        An interrupted migration leaves the inactive bank without a valid
+        sequence number, so the active bank remains authoritative.
+
     Write log structure:
 
         The first 8 bytes of the write log are a FNV1a_64 hash of the contents
@@ -156,6 +181,38 @@
         ╚════════════════╝
         0 <= Address <= 0x3FFE (16382) */
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+// FNV1a_64 of the consolidated area, followed by the bank's sequence number
+#    define WEAR_LEVELING_LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + 16)
+#    define BANK_ADDRESS(address) (wear_leveling.bank_base + (address))
+#    define INACTIVE_BANK_BASE ((WEAR_LEVELING_BANK_SIZE) - wear_leveling.bank_base)
+// Start migrating once half of the active bank's write log has been used
+#    define MIGRATION_THRESHOLD (WEAR_LEVELING_LOG_START + ((WEAR_LEVELING_BANK_SIZE) - WEAR_LEVELING_LOG_START) / 2)
+
+/**
+ * Background consolidation state.
+ */
+typedef enum wear_leveling_migration_state_t {
+    MIGRATION_ERASING, //< The inactive bank is being erased
+    MIGRATION_IDLE,    //< The inactive bank is erased, and ready for the next migration
+    MIGRATION_COPYING, //< The cache is being copied into the inactive bank
+} wear_leveling_migration_state_t;
+#else // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+// FNV1a_64 of the consolidated area
+#    define WEAR_LEVELING_LOG_START ((WEAR_LEVELING_LOGICAL_SIZE) + 8)
+#    define BANK_ADDRESS(address) (address)
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
+#ifdef WEAR_LEVELING_COALESCE_WRITES
+/**
+ * Logical address range modified in the cache, but not yet appended to the write log.
+ */
+typedef struct wear_leveling_pending_write_t {
+    uint32_t address;
+    uint32_t length; //< Zero if the slot is unused
+} wear_leveling_pending_write_t;
+#endif // WEAR_LEVELING_COALESCE_WRITES
+
 /**
  * Storage area for the wear-leveling cache.
  */
@@ -163,6 +220,21 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_COALESCE_WRITES
+    wear_leveling_pending_write_t pending[(WEAR_LEVELING_COALESCE_SLOTS)];
+    wear_leveling_stats_t         stats;
+#endif // WEAR_LEVELING_COALESCE_WRITES
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    uint32_t bank_base; //< Offset of the active bank within the backing store
+    uint64_t sequence;  //< Sequence number of the active bank
+    struct {
+        wear_leveling_migration_state_t state;
+        uint32_t                        progress;      //< Bytes of the inactive bank erased, or of the cache copied
+        uint32_t                        write_address; //< Next write log location within the inactive bank
+        uint64_t                        checksum;      //< FNV1a_64 of the data copied so far
+        bool                            mirroring;     //< Write log appends are targeting the inactive bank
+    } migration;
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
 } wear_leveling;
 
 /**
@@ -203,18 +275,25 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+#ifdef WEAR_LEVELING_COALESCE_WRITES
+    // Anything still pending refers to the old cache contents
+    memset(wear_leveling.pending, 0, sizeof(wear_leveling.pending));
+#endif // WEAR_LEVELING_COALESCE_WRITES
 }
 
 /**
  * Reads the consolidated data from the backing store into the cache.
  * Does not consider the write log.
+ *
+ * @param valid[out] whether the consolidated data matched its checksum
  */
-static wear_leveling_status_t wear_leveling_read_consolidated(void) {
+static wear_leveling_status_t wear_leveling_read_consolidated(bool *valid) {
     wl_dprintf("Reading consolidated data\n");
 
+    *valid                        = false;
     wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
-    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_read_bulk(BANK_ADDRESS(0), (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to read from backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
@@ -225,16 +304,17 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
         write_log_entry_t entry;
         wl_dprintf("Reading checksum\n");
 #if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
+        backing_store_read_bulk(BANK_ADDRESS(WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
 #elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
+        backing_store_read_bulk(BANK_ADDRESS(WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
 #elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
+        backing_store_read(BANK_ADDRESS(WEAR_LEVELING_LOGICAL_SIZE), &entry.raw64);
 #endif
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
         if (entry.raw64 == expected) {
             wl_dprintf("Checksum matches, consolidated data is correct\n");
+            *valid = true;
         } else {
             wl_dprintf("Checksum mismatch, clearing cache\n");
             wear_leveling_clear_cache();
@@ -249,6 +329,7 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     return status;
 }
 
+#ifndef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
 /**
  * Writes the current cache to consolidated data at the beginning of the backing store.
  * Does not clear the write log.
@@ -317,11 +398,211 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.write_address = WEAR_LEVELING_LOG_START;
+
+    return status;
+}
+#else  // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Reads a 64-bit value, such as a checksum or sequence number, from an absolute backing store address.
+ */
+static bool wear_leveling_read_u64(uint32_t address, uint64_t *value) {
+    write_log_entry_t entry;
+    bool              ok;
+#    if BACKING_STORE_WRITE_SIZE == 2
+    ok = backing_store_read_bulk(address, entry.raw16, 4);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+    ok = backing_store_read_bulk(address, entry.raw32, 2);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+    ok = backing_store_read(address, &entry.raw64);
+#    endif
+    *value = ok ? entry.raw64 : 0;
+    return ok;
+}
+
+/**
+ * Writes a 64-bit value, such as a checksum or sequence number, to an absolute backing store address.
+ */
+static bool wear_leveling_write_u64(uint32_t address, uint64_t value) {
+    write_log_entry_t entry = {.raw64 = value};
+#    if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry.raw16, 4);
+#    elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk(address, entry.raw32, 2);
+#    elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry.raw64);
+#    endif
+}
+
+/**
+ * Checks whether the inactive bank reads back as erased.
+ */
+static bool wear_leveling_inactive_bank_is_erased(void) {
+    backing_store_int_t values[8];
+    for (uint32_t offset = 0; offset < (WEAR_LEVELING_BANK_SIZE); offset += sizeof(values)) {
+        if (!backing_store_read_bulk(INACTIVE_BANK_BASE + offset, values, sizeof(values) / sizeof(backing_store_int_t))) {
+            return false;
+        }
+        for (size_t i = 0; i < sizeof(values) / sizeof(backing_store_int_t); ++i) {
+            if (values[i] != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Abandons any migration in progress, and schedules the inactive bank to be erased.
+ */
+static void wear_leveling_migration_reset(void) {
+    wear_leveling.migration.state    = MIGRATION_ERASING;
+    wear_leveling.migration.progress = 0;
+}
+
+/**
+ * Fallback for backing stores that can't erase the inactive bank by itself, such as a bank that isn't aligned to the
+ * flash's erase units: erases the whole backing store, then writes the cache to the first bank.
+ * During this operation, there is the potential for data loss if a power loss occurs.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_full(void) {
+    wl_dprintf("Erasing backing store\n");
+    if (!backing_store_erase()) {
+        wl_dprintf("Failed to erase backing store\n");
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Both banks are now empty, so the first one is written and the other is ready for the next migration
+    memset(&wear_leveling.migration, 0, sizeof(wear_leveling.migration));
+    wear_leveling.migration.state = MIGRATION_IDLE;
+    wear_leveling.bank_base       = 0;
+    wear_leveling.write_address   = WEAR_LEVELING_LOG_START;
+
+    wl_dprintf("Writing consolidated data\n");
+    const uint64_t checksum = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+    bool           ok       = backing_store_write_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t));
+    ok                      = ok && wear_leveling_write_u64((WEAR_LEVELING_LOGICAL_SIZE), checksum);
+    ok                      = ok && wear_leveling_write_u64((WEAR_LEVELING_LOGICAL_SIZE) + 8, wear_leveling.sequence + 1);
+    if (!ok) {
+        wl_dprintf("Failed to write consolidated data\n");
+        // The first bank is in an unknown state, start over
+        wear_leveling_migration_reset();
+        return WEAR_LEVELING_FAILED;
+    }
+    wear_leveling.sequence++;
+    return WEAR_LEVELING_CONSOLIDATED;
+}
+
+/**
+ * Erases the next erase unit of the inactive bank, falling back to a full consolidation if it can't be erased.
+ */
+static wear_leveling_status_t wear_leveling_migration_erase_step(void) {
+    uint32_t remaining = (WEAR_LEVELING_BANK_SIZE) - wear_leveling.migration.progress;
+    uint32_t erased    = 0;
+    if (!backing_store_erase_partial(INACTIVE_BANK_BASE + wear_leveling.migration.progress, remaining, &erased) || erased == 0) {
+        wl_dprintf("Failed to erase inactive bank\n");
+        return wear_leveling_consolidate_full();
+    }
+
+    wear_leveling.migration.progress += erased;
+    if (wear_leveling.migration.progress >= (WEAR_LEVELING_BANK_SIZE)) {
+        wl_dprintf("Inactive bank erased\n");
+        wear_leveling.migration.state = MIGRATION_IDLE;
+    }
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * Copies the next chunk of the cache into the inactive bank, committing the migration once the entire cache is copied.
+ *
+ * @return WEAR_LEVELING_CONSOLIDATED once the banks have been swapped
+ */
+static wear_leveling_status_t wear_leveling_migration_copy_step(void) {
+    const uint32_t offset = wear_leveling.migration.progress;
+    const uint32_t length = ((WEAR_LEVELING_LOGICAL_SIZE) - offset) < (WEAR_LEVELING_INCREMENTAL_STEP_SIZE) ? ((WEAR_LEVELING_LOGICAL_SIZE) - offset) : (WEAR_LEVELING_INCREMENTAL_STEP_SIZE);
+    if (!backing_store_write_bulk(INACTIVE_BANK_BASE + offset, (backing_store_int_t *)&wear_leveling.cache[offset], length / sizeof(backing_store_int_t))) {
+        wl_dprintf("Failed to write to inactive bank\n");
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // Only the data actually written is covered by the checksum -- later changes to it are in the inactive bank's write log
+    wear_leveling.migration.checksum = fnv_64a_buf(&wear_leveling.cache[offset], length, wear_leveling.migration.checksum);
+    wear_leveling.migration.progress += length;
+    if (wear_leveling.migration.progress < (WEAR_LEVELING_LOGICAL_SIZE)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Commit -- the sequence number is written last, as its presence is what marks the bank as valid
+    wl_dprintf("Committing inactive bank\n");
+    if (!wear_leveling_write_u64(INACTIVE_BANK_BASE + (WEAR_LEVELING_LOGICAL_SIZE), wear_leveling.migration.checksum)) {
+        return WEAR_LEVELING_FAILED;
+    }
+    if (!wear_leveling_write_u64(INACTIVE_BANK_BASE + (WEAR_LEVELING_LOGICAL_SIZE) + 8, wear_leveling.sequence + 1)) {
+        return WEAR_LEVELING_FAILED;
+    }
 
+    // Swap banks, and get rid of the stale one in the background
+    wear_leveling.bank_base     = INACTIVE_BANK_BASE;
+    wear_leveling.write_address = wear_leveling.migration.write_address;
+    wear_leveling.sequence++;
+    wear_leveling_migration_reset();
+    return WEAR_LEVELING_CONSOLIDATED;
+}
+
+/**
+ * Advances background consolidation by a single step.
+ *
+ * @param force start a migration even if the write log has not reached the threshold
+ */
+static wear_leveling_status_t wear_leveling_migration_step(bool force) {
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    switch (wear_leveling.migration.state) {
+        case MIGRATION_ERASING:
+            status = wear_leveling_migration_erase_step();
+            break;
+
+        case MIGRATION_IDLE:
+            if (!force && wear_leveling.write_address < MIGRATION_THRESHOLD) {
+                break;
+            }
+            wl_dprintf("Starting migration to inactive bank\n");
+            wear_leveling.migration.state         = MIGRATION_COPYING;
+            wear_leveling.migration.progress      = 0;
+            wear_leveling.migration.write_address = WEAR_LEVELING_LOG_START;
+            wear_leveling.migration.checksum      = FNV1A_64_INIT;
+            // fall through
+
+        case MIGRATION_COPYING:
+            status = wear_leveling_migration_copy_step();
+            if (status == WEAR_LEVELING_FAILED) {
+                // The inactive bank is in an unknown state, start over
+                wear_leveling_migration_reset();
+            }
+            break;
+    }
     return status;
 }
 
+/**
+ * Forces a write of the current cache, by completing any outstanding migration steps in-line.
+ * The active bank is not modified, so a power loss during this operation does not lose data.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+    wl_dprintf("Completing migration in-line\n");
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    wear_leveling_status_t      status;
+    do {
+        status = wear_leveling_migration_step(true);
+    } while (status == WEAR_LEVELING_SUCCESS);
+
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
+    return status;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 /**
  * Potential write of the current cache to the backing store.
  * Skipped if the current write log position is not at the end of the backing store.
@@ -330,7 +611,7 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
-    if (wear_leveling.write_address >= (WEAR_LEVELING_BACKING_SIZE)) {
+    if (wear_leveling.write_address >= (WEAR_LEVELING_BANK_SIZE)) {
         return wear_leveling_consolidate_force();
     }
 
@@ -343,12 +624,23 @@ static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value) {
-    bool ok = backing_store_write(wear_leveling.write_address, value);
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    // The write log must never spill over into the other bank
+    if (wear_leveling.write_address >= (WEAR_LEVELING_BANK_SIZE)) {
+        return WEAR_LEVELING_FAILED;
+    }
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    bool ok = backing_store_write(BANK_ADDRESS(wear_leveling.write_address), value);
     if (!ok) {
         wl_dprintf("Failed to write to backing store\n");
         return WEAR_LEVELING_FAILED;
     }
     wear_leveling.write_address += (BACKING_STORE_WRITE_SIZE);
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    if (wear_leveling.migration.mirroring) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
     return wear_leveling_consolidate_if_needed();
 }
 
@@ -470,6 +762,41 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     return status;
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Appends the cached logical data for the supplied range to the inactive bank's write log, if that range has already been copied.
+ * Any part of the range not yet copied is picked up from the cache by a later copy step instead.
+ */
+static void wear_leveling_write_mirror(uint32_t address, size_t length) {
+    if (wear_leveling.migration.state != MIGRATION_COPYING || address >= wear_leveling.migration.progress) {
+        return;
+    }
+    if (address + length > wear_leveling.migration.progress) {
+        length = wear_leveling.migration.progress - address;
+    }
+
+    // Temporarily retarget the write log at the inactive bank
+    const uint32_t active_base          = wear_leveling.bank_base;
+    const uint32_t active_write_address = wear_leveling.write_address;
+    wear_leveling.bank_base             = INACTIVE_BANK_BASE;
+    wear_leveling.write_address         = wear_leveling.migration.write_address;
+    wear_leveling.migration.mirroring   = true;
+
+    wear_leveling_status_t status = wear_leveling_write_raw(address, &wear_leveling.cache[address], length);
+
+    wear_leveling.migration.mirroring     = false;
+    wear_leveling.migration.write_address = wear_leveling.write_address;
+    wear_leveling.bank_base               = active_base;
+    wear_leveling.write_address           = active_write_address;
+
+    if (status == WEAR_LEVELING_FAILED) {
+        // The inactive bank no longer matches the cache, start over
+        wl_dprintf("Failed to mirror write to inactive bank\n");
+        wear_leveling_migration_reset();
+    }
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 /**
  * "Replays" the write log from the backing store, updating the local cache with updated values.
  */
@@ -478,10 +805,10 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
+    uint32_t               address         = WEAR_LEVELING_LOG_START;
+    while (!cancel_playback && address < (WEAR_LEVELING_BANK_SIZE)) {
         backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
+        bool                ok = backing_store_read(BANK_ADDRESS(address), &value);
         if (!ok) {
             wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
             cancel_playback = true;
@@ -510,7 +837,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
         switch (LOG_ENTRY_GET_TYPE(log)) {
             case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
+                ok = backing_store_read(BANK_ADDRESS(address), &log.raw16[1]);
                 if (!ok) {
                     wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                     cancel_playback = true;
@@ -530,7 +857,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
 #if BACKING_STORE_WRITE_SIZE == 2
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
+                    ok = backing_store_read(BANK_ADDRESS(address), &log.raw16[2]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -540,7 +867,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                     address += (BACKING_STORE_WRITE_SIZE);
                 }
                 if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
+                    ok = backing_store_read(BANK_ADDRESS(address), &log.raw16[3]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -551,7 +878,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 }
 #elif BACKING_STORE_WRITE_SIZE == 4
                 if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
+                    ok = backing_store_read(BANK_ADDRESS(address), &log.raw32[1]);
                     if (!ok) {
                         wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
                         cancel_playback = true;
@@ -612,6 +939,52 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Selects the newest bank with valid consolidated data as the active bank, and reads its consolidated data into the cache.
+ * Does not consider the write log.
+ */
+static wear_leveling_status_t wear_leveling_select_bank(void) {
+    uint64_t sequences[2];
+    if (!wear_leveling_read_u64((WEAR_LEVELING_LOGICAL_SIZE) + 8, &sequences[0]) || !wear_leveling_read_u64((WEAR_LEVELING_BANK_SIZE) + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &sequences[1])) {
+        wl_dprintf("Failed to read bank sequence numbers\n");
+        return WEAR_LEVELING_FAILED;
+    }
+
+    // A bank is only valid once its sequence number has been written, which is the last step of a migration
+    const int newest = sequences[1] > sequences[0] ? 1 : 0;
+    for (int i = 0; i < 2; ++i) {
+        const int bank = i == 0 ? newest : 1 - newest;
+        if (sequences[bank] == 0) {
+            continue;
+        }
+
+        bool valid;
+        wear_leveling.bank_base = bank * (WEAR_LEVELING_BANK_SIZE);
+        if (wear_leveling_read_consolidated(&valid) == WEAR_LEVELING_FAILED) {
+            return WEAR_LEVELING_FAILED;
+        }
+        if (valid) {
+            wl_dprintf("Using bank %d\n", bank);
+            wear_leveling.sequence = sequences[bank];
+            break;
+        }
+    }
+
+    // Neither bank has been committed yet -- the first bank's write log may still hold data
+    if (wear_leveling.sequence == 0) {
+        wl_dprintf("No valid bank, using first bank\n");
+        wear_leveling.bank_base = 0;
+        wear_leveling_clear_cache();
+    }
+
+    // Anything in the inactive bank is either stale or a migration interrupted by power loss
+    wear_leveling.migration.progress = 0;
+    wear_leveling.migration.state    = wear_leveling_inactive_bank_is_erased() ? MIGRATION_IDLE : MIGRATION_ERASING;
+    return WEAR_LEVELING_SUCCESS;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 /**
  * Wear-leveling initialization
  */
@@ -620,6 +993,11 @@ wear_leveling_status_t wear_leveling_init(void) {
 
     // Reset the cache
     wear_leveling_clear_cache();
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    memset(&wear_leveling.migration, 0, sizeof(wear_leveling.migration));
+    wear_leveling.bank_base = 0;
+    wear_leveling.sequence  = 0;
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
 
     // Initialise the backing store
     if (!backing_store_init()) {
@@ -629,7 +1007,12 @@ wear_leveling_status_t wear_leveling_init(void) {
     }
 
     // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
-    wear_leveling_status_t status = wear_leveling_read_consolidated();
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    wear_leveling_status_t status = wear_leveling_select_bank();
+#else  // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    bool                   valid;
+    wear_leveling_status_t status = wear_leveling_read_consolidated(&valid);
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
     if (status == WEAR_LEVELING_FAILED) {
         // If it failed, clear the cache and return with failure
         wear_leveling_clear_cache();
@@ -663,6 +1046,13 @@ wear_leveling_status_t wear_leveling_erase(void) {
     // Perform the erase
     bool ret = backing_store_erase();
     wear_leveling_clear_cache();
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    // Both banks are now empty, start over with the first
+    memset(&wear_leveling.migration, 0, sizeof(wear_leveling.migration));
+    wear_leveling.migration.state = MIGRATION_IDLE;
+    wear_leveling.bank_base       = 0;
+    wear_leveling.sequence        = 0;
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
 
     // Lock the backing store if we acquired the lock successfully
     if (lock_status == STATUS_SUCCESS) {
@@ -673,25 +1063,9 @@ wear_leveling_status_t wear_leveling_erase(void) {
 }
 
 /**
- * Writes logical data into the backing store. Skips writes if there are no changes to values.
+ * Appends the cached logical data for the supplied range to the write log, consolidating if required.
  */
-wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *value, size_t length) {
-    wl_assert(address + length <= (WEAR_LEVELING_LOGICAL_SIZE));
-    if (address + length > (WEAR_LEVELING_LOGICAL_SIZE)) {
-        return WEAR_LEVELING_FAILED;
-    }
-
-    wl_dprintf("Write ");
-    wl_dump(address, value, length);
-
-    // Skip write if there's no change compared to the current cached value
-    if (memcmp(value, &wear_leveling.cache[address], length) == 0) {
-        return true;
-    }
-
-    // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
-    memcpy(&wear_leveling.cache[address], value, length);
-
+static wear_leveling_status_t wear_leveling_write_through(const uint32_t address, size_t length) {
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -699,8 +1073,13 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
         return WEAR_LEVELING_FAILED;
     }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    // Keep any migration in progress up to date; a failure here only restarts the migration
+    wear_leveling_write_mirror(address, length);
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
     // Perform the actual write
-    wear_leveling_status_t status = wear_leveling_write_raw(address, value, length);
+    wear_leveling_status_t status = wear_leveling_write_raw(address, &wear_leveling.cache[address], length);
     switch (status) {
         case WEAR_LEVELING_CONSOLIDATED:
         case WEAR_LEVELING_FAILED:
@@ -727,6 +1106,166 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+#ifdef WEAR_LEVELING_COALESCE_WRITES
+/**
+ * Records a modified range of the cache, merging it with any pending range it overlaps or touches.
+ *
+ * @return false if there was no free slot for the range
+ */
+static bool wear_leveling_defer(uint32_t address, size_t length) {
+    uint32_t start  = address;
+    uint32_t end    = address + (uint32_t)length;
+    bool     merged = false;
+
+    // Absorb every pending range that overlaps or is adjacent, as the merged range may now bridge several of them
+    for (int i = 0; i < (WEAR_LEVELING_COALESCE_SLOTS); ++i) {
+        wear_leveling_pending_write_t *slot = &wear_leveling.pending[i];
+        if (slot->length == 0 || slot->address > end || slot->address + slot->length < start) {
+            continue;
+        }
+        if (slot->address < start) {
+            start = slot->address;
+        }
+        if (slot->address + slot->length > end) {
+            end = slot->address + slot->length;
+        }
+        slot->length = 0;
+        merged       = true;
+    }
+
+    for (int i = 0; i < (WEAR_LEVELING_COALESCE_SLOTS); ++i) {
+        wear_leveling_pending_write_t *slot = &wear_leveling.pending[i];
+        if (slot->length == 0) {
+            slot->address = start;
+            slot->length  = end - start;
+            if (merged) {
+                ++wear_leveling.stats.coalesced_writes;
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Appends all pending ranges to the write log.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+    if (!wear_leveling_has_pending_writes()) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wl_dprintf("Flush\n");
+
+    // Hold the backing store unlocked across all of the pending ranges
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (int i = 0; i < (WEAR_LEVELING_COALESCE_SLOTS); ++i) {
+        wear_leveling_pending_write_t *slot = &wear_leveling.pending[i];
+        if (slot->length == 0) {
+            continue;
+        }
+
+        status = wear_leveling_write_through(slot->address, slot->length);
+        if (status == WEAR_LEVELING_FAILED) {
+            // Leave this and any remaining ranges pending, so a later flush can retry
+            break;
+        }
+
+        slot->length = 0;
+        ++wear_leveling.stats.flushed_writes;
+
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            // The entire cache was written out as part of consolidation, so nothing else is pending
+            memset(wear_leveling.pending, 0, sizeof(wear_leveling.pending));
+            break;
+        }
+    }
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    ++wear_leveling.stats.flushes;
+    return status;
+}
+
+/**
+ * Checks whether any writes are waiting for a flush.
+ */
+bool wear_leveling_has_pending_writes(void) {
+    for (int i = 0; i < (WEAR_LEVELING_COALESCE_SLOTS); ++i) {
+        if (wear_leveling.pending[i].length != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Retrieves the write coalescing counters.
+ */
+const wear_leveling_stats_t *wear_leveling_get_stats(void) {
+    return &wear_leveling.stats;
+}
+#else  // WEAR_LEVELING_COALESCE_WRITES
+wear_leveling_status_t wear_leveling_flush(void) {
+    return WEAR_LEVELING_SUCCESS;
+}
+
+bool wear_leveling_has_pending_writes(void) {
+    return false;
+}
+#endif // WEAR_LEVELING_COALESCE_WRITES
+
+/**
+ * Writes logical data into the backing store. Skips writes if there are no changes to values.
+ */
+wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *value, size_t length) {
+    wl_assert(address + length <= (WEAR_LEVELING_LOGICAL_SIZE));
+    if (address + length > (WEAR_LEVELING_LOGICAL_SIZE)) {
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wl_dprintf("Write ");
+    wl_dump(address, value, length);
+
+    // Skip write if there's no change compared to the current cached value
+    if (memcmp(value, &wear_leveling.cache[address], length) == 0) {
+        return true;
+    }
+
+#ifdef WEAR_LEVELING_COALESCE_WRITES
+    // Make room before touching the cache, so that a flush only ever writes out complete writes
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    if (!wear_leveling_defer(address, length)) {
+        status = wear_leveling_flush();
+        if (status == WEAR_LEVELING_FAILED) {
+            // Fall back to writing straight through, matching the behaviour without coalescing
+            memcpy(&wear_leveling.cache[address], value, length);
+            return wear_leveling_write_through(address, length);
+        }
+        wear_leveling_defer(address, length);
+    }
+
+    memcpy(&wear_leveling.cache[address], value, length);
+    ++wear_leveling.stats.deferred_writes;
+    return status;
+#else
+    // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
+    memcpy(&wear_leveling.cache[address], value, length);
+    return wear_leveling_write_through(address, length);
+#endif // WEAR_LEVELING_COALESCE_WRITES
+}
+
 /**
  * Reads logical data from the cache.
  */
@@ -744,6 +1283,33 @@ wear_leveling_status_t wear_leveling_read(const uint32_t address, void *value, s
     return WEAR_LEVELING_SUCCESS;
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Advances background consolidation by a single bounded step.
+ */
+wear_leveling_status_t wear_leveling_consolidate_step(void) {
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = wear_leveling_migration_step(false);
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+
+bool wear_leveling_consolidation_pending(void) {
+    return wear_leveling.migration.state != MIGRATION_IDLE || wear_leveling.write_address >= MIGRATION_THRESHOLD;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 /**
  * Weak implementation of bulk read, drivers can implement more optimised implementations.
  */
@@ -767,3 +1333,13 @@ __attribute__((weak)) bool backing_store_write_bulk(uint32_t address, backing_st
     }
     return true;
 }
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Weak implementation of partial erase, for drivers which can only erase the whole backing store.
+ */
+__attribute__((weak)) bool backing_store_erase_partial(uint32_t address, uint32_t max_length, uint32_t *erased_length) {
+    *erased_length = 0;
+    return false;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
@@ -1,6 +1,7 @@
 // Copyright 2022 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -52,3 +53,66 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Appends any coalesced writes to the backing store.
+ *
+ * Only has an effect with `WEAR_LEVELING_COALESCE_WRITES`, where writes are held in RAM until flushed, or until there
+ * is no room to track another modified range.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
+
+/**
+ * Checks whether any coalesced writes have yet to be flushed to the backing store.
+ *
+ * @return true if a flush is required
+ */
+bool wear_leveling_has_pending_writes(void);
+
+#ifdef WEAR_LEVELING_COALESCE_WRITES
+#    ifndef WEAR_LEVELING_COALESCE_SLOTS
+#        define WEAR_LEVELING_COALESCE_SLOTS 8
+#    endif
+
+/**
+ * @typedef Write coalescing counters.
+ *
+ * The number of write log appends avoided is `deferred_writes - flushed_writes`.
+ */
+typedef struct wear_leveling_stats_t {
+    uint32_t deferred_writes;  //< Writes which changed data, and were held in RAM
+    uint32_t coalesced_writes; //< Deferred writes merged with an already-pending range
+    uint32_t flushed_writes;   //< Merged ranges actually appended to the write log
+    uint32_t flushes;          //< Number of flushes performed
+} wear_leveling_stats_t;
+
+/**
+ * Retrieves the write coalescing counters.
+ *
+ * @return pointer to the counters
+ */
+const wear_leveling_stats_t* wear_leveling_get_stats(void);
+#endif // WEAR_LEVELING_COALESCE_WRITES
+
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Advances background consolidation by a single step.
+ *
+ * The backing store is split into two banks. Once the active bank's write log is half full, the cache is copied into
+ * the other bank a chunk at a time, which is then committed and swapped in, and the stale bank erased one erase unit at
+ * a time. Each invocation performs at most one chunk copy or one partial erase, so it is suitable for calling from a
+ * periodic task.
+ *
+ * @return WEAR_LEVELING_CONSOLIDATED once the banks have been swapped, otherwise status of the request
+ */
+wear_leveling_status_t wear_leveling_consolidate_step(void);
+
+/**
+ * Checks whether background consolidation has any work left to do.
+ *
+ * @return true if `wear_leveling_consolidate_step()` should be invoked
+ */
+bool wear_leveling_consolidation_pending(void);
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION